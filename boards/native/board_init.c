@@ -43,6 +43,9 @@ static mtd_native_dev_t mtd0_dev = {
         .page_size = MTD_PAGE_SIZE,
     },
     .fname = MTD_NATIVE_FILENAME,
+    .sparse = MTD_NATIVE_SPARSE,
+    .erase_us = MTD_NATIVE_ERASE_US,
+    .write_us = MTD_NATIVE_WRITE_US,
 };
 
 mtd_dev_t *mtd0 = (mtd_dev_t *)&mtd0_dev;
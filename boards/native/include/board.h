@@ -71,6 +71,15 @@ void _native_LED_RED_TOGGLE(void);
 #ifndef MTD_NATIVE_FILENAME
 #define MTD_NATIVE_FILENAME     "MEMORY.bin"
 #endif
+#ifndef MTD_NATIVE_SPARSE
+#define MTD_NATIVE_SPARSE       (0)     /**< keep erased areas as file holes */
+#endif
+#ifndef MTD_NATIVE_ERASE_US
+#define MTD_NATIVE_ERASE_US     (0)     /**< emulated sector erase time */
+#endif
+#ifndef MTD_NATIVE_WRITE_US
+#define MTD_NATIVE_WRITE_US     (0)     /**< emulated page program time */
+#endif
 /** @} */
 
 /** Default MTD device */
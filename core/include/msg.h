@@ -147,6 +147,20 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Lock-free message queue
+ * -----------------------
+ * By default, the message queue is protected by disabling IRQs for the whole
+ * send path. With the `core_msg_lockfree` module, producers reserve and fill
+ * their slot of the queue with atomic operations instead, so @ref
+ * msg_try_send() and @ref msg_send_int() disable IRQs only briefly to wake up
+ * the receiving thread, if it is waiting for a message. This shortens the
+ * time IRQs are disabled when ISRs send many messages to threads. The
+ * behavior of the API is unchanged, except that a message is only received
+ * once its sender finished copying it into the queue, so @ref msg_avail() may
+ * briefly count a message that @ref msg_try_receive() does not return yet.
+ * Messages of different senders may be received in a different order than
+ * they were queued, if a sender is preempted while copying its message.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
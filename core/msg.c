@@ -33,6 +33,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "kernel_defines.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -41,18 +42,96 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
-static int queue_msg(thread_t *target, const msg_t *m)
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+/*
+ * Lock-free message queue with multiple producers and the owning thread as
+ * single consumer.
+ *
+ * A producer reserves a slot by advancing msg_queue.write_count with a
+ * compare and swap, copies the message into it and publishes the message by
+ * setting msg_t::sender_pid last. The consumer only takes the message at
+ * msg_queue.read_count, once it was published. It resets its sender_pid to
+ * KERNEL_PID_UNDEF before advancing read_count, which hands the slot back to
+ * the producers. So a slot reserved by a preempted producer appears empty to
+ * the consumer until it is published.
+ */
+static int _queue_put(thread_t *target, const msg_t *m)
+{
+    cib_t *queue = &target->msg_queue;
+    unsigned int write_count;
+
+    assert(m->sender_pid != KERNEL_PID_UNDEF);
+    do {
+        /* read_count first, so write_count can never be behind it */
+        unsigned int read_count = __atomic_load_n(&queue->read_count,
+                                                  __ATOMIC_ACQUIRE);
+
+        write_count = __atomic_load_n(&queue->write_count, __ATOMIC_RELAXED);
+        if ((write_count - read_count) > queue->mask) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&queue->write_count, &write_count,
+                                          write_count + 1, false,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    msg_t *dest = &target->msg_array[write_count & queue->mask];
+
+    dest->type = m->type;
+    dest->content = m->content;
+    __atomic_store_n(&dest->sender_pid, m->sender_pid, __ATOMIC_RELEASE);
+    return 1;
+}
+
+static int _queue_get(thread_t *me, msg_t *m)
+{
+    cib_t *queue = &me->msg_queue;
+    msg_t *src = &me->msg_array[queue->read_count & queue->mask];
+    kernel_pid_t sender_pid = __atomic_load_n(&src->sender_pid,
+                                              __ATOMIC_ACQUIRE);
+
+    if (sender_pid == KERNEL_PID_UNDEF) {
+        return 0;
+    }
+    m->type = src->type;
+    m->content = src->content;
+    m->sender_pid = sender_pid;
+    src->sender_pid = KERNEL_PID_UNDEF;
+    __atomic_store_n(&queue->read_count, queue->read_count + 1,
+                     __ATOMIC_RELEASE);
+    return 1;
+}
+#else /* IS_USED(MODULE_CORE_MSG_LOCKFREE) */
+static int _queue_put(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
 
     if (n < 0) {
+        return 0;
+    }
+    target->msg_array[n] = *m;
+    return 1;
+}
+
+static int _queue_get(thread_t *me, msg_t *m)
+{
+    int n = cib_get(&(me->msg_queue));
+
+    if (n < 0) {
+        return 0;
+    }
+    *m = me->msg_array[n];
+    return 1;
+}
+#endif /* IS_USED(MODULE_CORE_MSG_LOCKFREE) */
+
+static int queue_msg(thread_t *target, const msg_t *m)
+{
+    if (!thread_has_msg_queue(target) || !_queue_put(target, m)) {
         DEBUG("queue_msg(): message queue is full (or there is none)\n");
         return 0;
     }
 
     DEBUG("queue_msg(): queuing message\n");
-    msg_t *dest = &target->msg_array[n];
-    *dest = *m;
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -60,6 +139,46 @@ static int queue_msg(thread_t *target, const msg_t *m)
     return 1;
 }
 
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+/*
+ * Queues a message without disabling IRQs. IRQs are only disabled to hand
+ * the first queued message over to the target, if it is waiting for one.
+ *
+ * Returns -1, if the target does not exist, 0, if it has no message queue or
+ * the queue is full, 2, if the target was woken up and 1 otherwise.
+ */
+static int _msg_send_lockfree(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = (thread_t *)sched_threads[target_pid];
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        return -1;
+    }
+    if (!thread_has_msg_queue(target) || !_queue_put(target, m)) {
+        DEBUG("%s: message queue is full (or there is none)\n", __func__);
+        return 0;
+    }
+
+    int res = 1;
+    unsigned state = irq_disable();
+
+    if ((target->status == STATUS_RECEIVE_BLOCKED) &&
+        _queue_get(target, (msg_t *)target->wait_data)) {
+        sched_set_status(target, STATUS_PENDING);
+        res = 2;
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    else {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        thread_flags_wake(target);
+    }
+#endif
+    irq_restore(state);
+    return res;
+}
+#endif /* IS_USED(MODULE_CORE_MSG_LOCKFREE) */
+
 int msg_send(msg_t *m, kernel_pid_t target_pid)
 {
     if (irq_is_in()) {
@@ -79,6 +198,20 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (sched_active_pid == target_pid) {
         return msg_send_to_self(m);
     }
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    m->sender_pid = sched_active_pid;
+
+    int res = _msg_send_lockfree(m, target_pid);
+
+    if (res == 2) {
+        thread_yield_higher();
+        return 1;
+    }
+    else if (res != 0) {
+        return res;
+    }
+    /* no queue or queue full, but the target might be waiting anyway */
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
@@ -231,7 +364,22 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
 
     m->sender_pid = KERNEL_PID_ISR;
 
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    res = _msg_send_lockfree(m, target_pid);
+    if (res == 2) {
+        sched_context_switch_request = 1;
+        return 1;
+    }
+    else if (res != 0) {
+        return res;
+    }
+    /* no queue or queue full, but the target might be waiting anyway */
+    unsigned state = irq_disable();
     res = _msg_send_oneway(m, target_pid);
+    irq_restore(state);
+#else
+    res = _msg_send_oneway(m, target_pid);
+#endif
 
     return res;
 }
@@ -348,23 +496,22 @@ static int _msg_receive(msg_t *m, int block)
 
     thread_t *me = (thread_t *)sched_threads[sched_active_pid];
 
-    int queue_index = -1;
+    int queued = 0;
 
     if (thread_has_msg_queue(me)) {
-        queue_index = cib_get(&(me->msg_queue));
+        queued = _queue_get(me, m);
     }
 
     /* no message, fail */
-    if ((!block) && ((!me->msg_waiters.next) && (queue_index == -1))) {
+    if ((!block) && ((!me->msg_waiters.next) && !queued)) {
         irq_restore(state);
         return -1;
     }
 
-    if (queue_index >= 0) {
+    if (queued) {
         DEBUG(
             "_msg_receive: %" PRIkernel_pid ": _msg_receive(): We've got a queued message.\n",
             sched_active_thread->pid);
-        *m = me->msg_array[queue_index];
     }
     else {
         me->wait_data = (void *)m;
@@ -377,7 +524,7 @@ static int _msg_receive(msg_t *m, int block)
             "_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in waiting list.\n",
             sched_active_thread->pid);
 
-        if (queue_index < 0) {
+        if (!queued) {
             DEBUG(
                 "_msg_receive(): %" PRIkernel_pid ": No msg in queue. Going blocked.\n",
                 sched_active_thread->pid);
@@ -403,16 +550,18 @@ static int _msg_receive(msg_t *m, int block)
         thread_t *sender =
             container_of((clist_node_t *)next, thread_t, rq_entry);
 
-        if (queue_index >= 0) {
+        /* copy msg */
+        msg_t *sender_msg = (msg_t *)sender->wait_data;
+
+        if (queued) {
             /* We've already got a message from the queue. As there is a
              * waiter, take it's message into the just freed queue space.
              */
-            m = &(me->msg_array[cib_put(&(me->msg_queue))]);
+            _queue_put(me, sender_msg);
+        }
+        else {
+            *m = *sender_msg;
         }
-
-        /* copy msg */
-        msg_t *sender_msg = (msg_t *)sender->wait_data;
-        *m = *sender_msg;
 
         /* remove sender from queue */
         uint16_t sender_prio = THREAD_PRIORITY_IDLE;
@@ -452,8 +601,14 @@ void msg_init_queue(msg_t *array, int num)
 {
     thread_t *me = (thread_t *)sched_active_thread;
 
-    me->msg_array = array;
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    /* mark all slots as free */
+    for (int i = 0; i < num; i++) {
+        array[i].sender_pid = KERNEL_PID_UNDEF;
+    }
+#endif
     cib_init(&(me->msg_queue), num);
+    me->msg_array = array;
 }
 
 void msg_queue_print(void)
@@ -12,6 +12,20 @@
  * @{
  * @brief       mtd flash emulation for native
  *
+ * The flash is emulated by a file which is mapped into memory on
+ * initialization, so reads and writes are plain memory accesses. Erased bytes
+ * read as 0xff and programming can only clear bits, like on NOR flash.
+ *
+ * If @ref mtd_native_dev_t::sparse is set, the file holds the inverted flash
+ * content. Erased areas are then holes of a sparse file, so large devices take
+ * disk space only for the data written to them. Such files are not
+ * interchangeable with plain images.
+ *
+ * Every device keeps @ref mtd_native_stats_t and an erase counter per sector.
+ * If erase and program latencies are configured, the time the flash would
+ * have been busy is added to the statistics, and the calling thread is put to
+ * sleep for that time when @ref mtd_native_dev_t::sleep is set.
+ *
  * @file
  *
  * @author      Vincent Dupont <vincent@otakeys.com>
@@ -24,12 +38,35 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "mtd.h"
 
+/**
+ * @brief   mtd native access statistics
+ */
+typedef struct {
+    uint32_t reads;             /**< number of read operations */
+    uint32_t writes;            /**< number of (partial) pages programmed */
+    uint32_t erases;            /**< number of sectors erased */
+    uint64_t read_bytes;        /**< number of bytes read */
+    uint64_t write_bytes;       /**< number of bytes programmed */
+    uint64_t busy_us;           /**< emulated time spent erasing and programming */
+    uint32_t max_wear;          /**< highest erase count of a sector */
+} mtd_native_stats_t;
+
 /** mtd native descriptor */
 typedef struct mtd_native_dev {
     mtd_dev_t dev;      /**< mtd generic device */
     const char *fname;  /**< filename to use for memory emulation */
+    bool sparse;        /**< store inverted content in a sparse file */
+    bool sleep;         /**< wait for the emulated latencies (needs xtimer) */
+    uint32_t erase_us;  /**< emulated time to erase a sector */
+    uint32_t write_us;  /**< emulated time to program a page */
+    uint8_t *map;       /**< mapped file, set by init */
+    uint32_t *wear;     /**< erase counter per sector, set by init */
+    mtd_native_stats_t stats;   /**< access statistics */
 } mtd_native_dev_t;
 
 /**
@@ -37,6 +74,28 @@ typedef struct mtd_native_dev {
  */
 extern const mtd_desc_t native_flash_driver;
 
+/**
+ * @brief   Get the number of times a sector was erased
+ *
+ * The counters start at zero when the device is initialized.
+ *
+ * @param[in] dev       the device
+ * @param[in] sector    the sector number
+ *
+ * @return  the erase count of @p sector, 0 if @p dev is not initialized
+ */
+uint32_t mtd_native_get_wear(const mtd_native_dev_t *dev, uint32_t sector);
+
+/**
+ * @brief   Reset the access statistics of a device
+ *
+ * The erase counters of the sectors and @ref mtd_native_stats_t::max_wear
+ * are kept.
+ *
+ * @param[in] dev       the device
+ */
+void mtd_native_reset_stats(mtd_native_dev_t *dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -112,6 +112,7 @@ extern int (*real_getpid)(void);
 extern int (*real_gettimeofday)(struct timeval *t, ...);
 extern int (*real_ioctl)(int fildes, int request, ...);
 extern int (*real_listen)(int socket, int backlog);
+extern off_t (*real_lseek)(int fd, off_t offset, int whence);
 extern int (*real_open)(const char *path, int oflag, ...);
 extern int (*real_pause)(void);
 extern int (*real_pipe)(int[2]);
@@ -19,115 +19,268 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "mtd.h"
 #include "mtd_native.h"
 
 #include "native_internal.h"
 
+#ifdef MODULE_XTIMER
+#include "xtimer.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+static size_t _size(const mtd_dev_t *dev)
+{
+    return (size_t)dev->sector_count * dev->pages_per_sector * dev->page_size;
+}
+
+static void _busy(mtd_native_dev_t *dev, uint32_t us)
+{
+    dev->stats.busy_us += us;
+#ifdef MODULE_XTIMER
+    if (dev->sleep && us) {
+        xtimer_usleep(us);
+    }
+#endif
+}
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _size(dev);
 
     DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
 
-    FILE *f = real_fopen(_dev->fname, "r");
+    if (_dev->map) {
+        return 0;
+    }
 
-    if (!f) {
-        DEBUG("mtd_native: init: creating file %s\n", _dev->fname);
-        f = real_fopen(_dev->fname, "w+");
-        if (!f) {
-            return -EIO;
-        }
-        size_t size = dev->sector_count * dev->pages_per_sector * dev->page_size;
-        for (size_t i = 0; i < size; i++) {
-            real_fputc(0xff, f);
+    int fd = real_open(_dev->fname, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return -EIO;
+    }
+    off_t fsize = real_lseek(fd, 0, SEEK_END);
+    if ((fsize < 0) ||
+        (((size_t)fsize < size) && (ftruncate(fd, size) < 0))) {
+        real_close(fd);
+        return -EIO;
+    }
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    /* the mapping stays valid without the file descriptor */
+    real_close(fd);
+    if (map == MAP_FAILED) {
+        return -EIO;
+    }
+    if (((size_t)fsize < size) && !_dev->sparse) {
+        DEBUG("mtd_native: init: erasing %" PRIu32 " new bytes\n",
+              (uint32_t)(size - fsize));
+        memset((uint8_t *)map + fsize, 0xff, size - fsize);
+    }
+
+    _dev->wear = real_calloc(dev->sector_count, sizeof(*_dev->wear));
+    if (!_dev->wear) {
+        munmap(map, size);
+        return -ENOMEM;
+    }
+    _dev->map = map;
+
+    return 0;
+}
+
+static void _copy_out(mtd_native_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    if (dev->sparse) {
+        uint8_t *out = buff;
+        for (uint32_t i = 0; i < size; i++) {
+            out[i] = ~dev->map[addr + i];
         }
     }
+    else {
+        memcpy(buff, dev->map + addr, size);
+    }
+}
+
+static void _program(mtd_native_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
+{
+    const uint8_t *in = buff;
+    uint8_t *flash = dev->map + addr;
 
-    real_fclose(f);
+    /* programming can only clear bits */
+    if (dev->sparse) {
+        for (uint32_t i = 0; i < size; i++) {
+            flash[i] |= ~in[i];
+        }
+    }
+    else {
+        for (uint32_t i = 0; i < size; i++) {
+            flash[i] &= in[i];
+        }
+    }
+}
 
+static int _check_write(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    if (addr + size > _size(dev)) {
+        return -EOVERFLOW;
+    }
+    if (((addr % dev->page_size) + size) > dev->page_size) {
+        return -EOVERFLOW;
+    }
+    if (!((mtd_native_dev_t *)dev)->map) {
+        return -EIO;
+    }
     return 0;
 }
 
 static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r");
-    if (!f) {
+    if (!_dev->map) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    size_t nread = real_fread(buff, 1, size, f);
-    real_fclose(f);
 
-    return (nread == size) ? 0 : -EIO;
+    _copy_out(_dev, buff, addr, size);
+    _dev->stats.reads++;
+    _dev->stats.read_bytes += size;
+
+    return 0;
 }
 
 static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: write from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
-        return -EOVERFLOW;
+    int res = _check_write(dev, addr, size);
+    if (res < 0) {
+        return res;
     }
-    if (((addr % dev->page_size) + size) > dev->page_size) {
+
+    _program(_dev, buff, addr, size);
+    _dev->stats.writes++;
+    _dev->stats.write_bytes += size;
+    _busy(_dev, _dev->write_us);
+
+    return 0;
+}
+
+#ifdef MODULE_MTD_ASYNC
+static int _readv(mtd_dev_t *dev, const iolist_t *iol, uint32_t addr)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    uint32_t size = iolist_size(iol);
+
+    DEBUG("mtd_native: readv from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
+
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
+    if (!_dev->map) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
+
+    for (; iol; iol = iol->iol_next) {
+        _copy_out(_dev, iol->iol_base, addr, iol->iol_len);
+        addr += iol->iol_len;
     }
-    real_fclose(f);
+    _dev->stats.reads++;
+    _dev->stats.read_bytes += size;
 
     return 0;
 }
 
+static int _writev(mtd_dev_t *dev, const iolist_t *iol, uint32_t addr)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    uint32_t size = iolist_size(iol);
+
+    DEBUG("mtd_native: writev from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
+
+    int res = _check_write(dev, addr, size);
+    if (res < 0) {
+        return res;
+    }
+
+    for (; iol; iol = iol->iol_next) {
+        _program(_dev, iol->iol_base, addr, iol->iol_len);
+        addr += iol->iol_len;
+    }
+    /* one program operation for the whole page */
+    _dev->stats.writes++;
+    _dev->stats.write_bytes += size;
+    _busy(_dev, _dev->write_us);
+
+    return 0;
+}
+#endif
+
+/* zero a range of the sparse file, whole host pages inside of it are
+ * punched out of the file if the file system supports that */
+static void _clear(uint8_t *start, size_t size)
+{
+#ifdef MADV_REMOVE
+    /* MADV_REMOVE works on whole pages, only hand it the pages that lie
+     * completely inside the range so neighbouring sectors are kept */
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t first = ((uintptr_t)start + page - 1) & ~(page - 1);
+    uintptr_t last = ((uintptr_t)start + size) & ~(page - 1);
+
+    if ((first < last) && (madvise((void *)first, last - first,
+                                   MADV_REMOVE) == 0)) {
+        memset(start, 0, first - (uintptr_t)start);
+        memset((void *)last, 0, (uintptr_t)start + size - last);
+        return;
+    }
+#endif
+    memset(start, 0, size);
+}
+
 static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
     size_t sector_size = dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _size(dev)) {
         return -EOVERFLOW;
     }
     if (((addr % sector_size) != 0) || ((size % sector_size) != 0)) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
+    if (!_dev->map) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        real_fputc(0xff, f);
+
+    if (_dev->sparse) {
+        _clear(_dev->map + addr, size);
+    }
+    else {
+        memset(_dev->map + addr, 0xff, size);
     }
-    real_fclose(f);
+
+    for (uint32_t sector = addr / sector_size;
+         sector < (addr + size) / sector_size; sector++) {
+        if (++_dev->wear[sector] > _dev->stats.max_wear) {
+            _dev->stats.max_wear = _dev->wear[sector];
+        }
+        _dev->stats.erases++;
+    }
+    _busy(_dev, _dev->erase_us * (size / sector_size));
 
     return 0;
 }
@@ -147,6 +300,25 @@ const mtd_desc_t native_flash_driver = {
     .write = _write,
     .erase = _erase,
     .init = _init,
+#ifdef MODULE_MTD_ASYNC
+    .readv = _readv,
+    .writev = _writev,
+#endif
 };
 
+uint32_t mtd_native_get_wear(const mtd_native_dev_t *dev, uint32_t sector)
+{
+    assert(sector < dev->dev.sector_count);
+
+    return dev->wear ? dev->wear[sector] : 0;
+}
+
+void mtd_native_reset_stats(mtd_native_dev_t *dev)
+{
+    uint32_t max_wear = dev->stats.max_wear;
+
+    memset(&dev->stats, 0, sizeof(dev->stats));
+    dev->stats.max_wear = max_wear;
+}
+
 /** @} */
@@ -78,6 +78,7 @@ int (*real_fork)(void);
 int (*real_feof)(FILE *stream);
 int (*real_ferror)(FILE *stream);
 int (*real_listen)(int socket, int backlog);
+off_t (*real_lseek)(int fd, off_t offset, int whence);
 int (*real_ioctl)(int fildes, int request, ...);
 int (*real_open)(const char *path, int oflag, ...);
 int (*real_pause)(void);
@@ -471,6 +472,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_execve) = dlsym(RTLD_NEXT, "execve");
     *(void **)(&real_ioctl) = dlsym(RTLD_NEXT, "ioctl");
     *(void **)(&real_listen) = dlsym(RTLD_NEXT, "listen");
+    *(void **)(&real_lseek) = dlsym(RTLD_NEXT, "lseek");
     *(void **)(&real_open) = dlsym(RTLD_NEXT, "open");
     *(void **)(&real_pause) = dlsym(RTLD_NEXT, "pause");
     *(void **)(&real_fopen) = dlsym(RTLD_NEXT, "fopen");
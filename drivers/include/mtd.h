@@ -14,6 +14,14 @@
  *
  * Generic memory technology device interface
  *
+ * With the `mtd_async` module, requests can also be queued with
+ * @ref mtd_submit(). They are processed in order by a worker thread, which
+ * calls the completion callback of each request. Adjacent requests of the same
+ * kind are merged into one driver operation: reads if the driver provides
+ * mtd_desc_t::readv, writes to the same page if it provides
+ * mtd_desc_t::writev, and erases always. Drivers without these functions are
+ * served by their blocking functions.
+ *
  * @file
  *
  * @author      Aurelien Gonce <aurelien.gonce@altran.com>
@@ -27,6 +35,12 @@
 #if MODULE_VFS
 #include "vfs.h"
 #endif
+#if MODULE_MTD_ASYNC
+#include "clist.h"
+#include "event.h"
+#include "iolist.h"
+#include "thread.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -52,6 +66,78 @@ enum mtd_power_state {
  */
 typedef struct mtd_desc mtd_desc_t;
 
+#if defined(MODULE_MTD_ASYNC) || defined(DOXYGEN)
+/**
+ * @name    Asynchronous request processing configuration
+ * @{
+ */
+/**
+ * @brief   Priority of the thread processing queued requests
+ */
+#ifndef CONFIG_MTD_ASYNC_PRIO
+#define CONFIG_MTD_ASYNC_PRIO       (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Stack size of the thread processing queued requests
+ *
+ * Completion callbacks run on this stack.
+ */
+#ifndef CONFIG_MTD_ASYNC_STACKSIZE
+#define CONFIG_MTD_ASYNC_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Maximum number of requests merged into one driver operation
+ */
+#ifndef CONFIG_MTD_ASYNC_MERGE_MAX
+#define CONFIG_MTD_ASYNC_MERGE_MAX  (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Kind of a queued MTD request
+ */
+typedef enum {
+    MTD_REQ_READ,               /**< read into mtd_req_t::buf */
+    MTD_REQ_WRITE,              /**< write from mtd_req_t::buf */
+    MTD_REQ_ERASE,              /**< erase sectors */
+} mtd_req_op_t;
+
+/**
+ * @brief   Queued MTD request
+ */
+typedef struct mtd_req mtd_req_t;
+
+/**
+ * @brief   Completion callback of a queued MTD request
+ *
+ * Called from the thread processing the requests, when the request is done.
+ * Use it to post an event or to wake up the submitting thread.
+ *
+ * @param[in] req   the completed request, mtd_req_t::res holds the result
+ */
+typedef void (*mtd_req_cb_t)(mtd_req_t *req);
+
+/**
+ * @brief   Queued MTD request
+ *
+ * The same restrictions on @p addr and @p count apply as for
+ * @ref mtd_read(), @ref mtd_write() and @ref mtd_erase(). The request and the
+ * buffer must stay valid until the callback was called.
+ */
+struct mtd_req {
+    clist_node_t node;          /**< queue entry, internal */
+    mtd_req_op_t op;            /**< what to do */
+    void *buf;                  /**< data buffer, unused for erase */
+    uint32_t addr;              /**< start address */
+    uint32_t count;             /**< number of bytes */
+    int res;                    /**< result, as the blocking function returns */
+    mtd_req_cb_t cb;            /**< completion callback, may be NULL */
+    void *arg;                  /**< argument for the callback */
+};
+#endif
+
 /**
  * @brief   MTD device descriptor
  */
@@ -60,6 +146,10 @@ typedef struct {
     uint32_t sector_count;     /**< Number of sector in the MTD */
     uint32_t pages_per_sector; /**< Number of pages by sector in the MTD */
     uint32_t page_size;        /**< Size of the pages in the MTD */
+#if defined(MODULE_MTD_ASYNC) || defined(DOXYGEN)
+    clist_node_t queue;        /**< Pending requests */
+    event_t event;             /**< Schedules processing of the requests */
+#endif
 } mtd_dev_t;
 
 /**
@@ -146,6 +236,49 @@ struct mtd_desc {
      * @return < 0 value on error
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
+
+    /**
+     * @brief   Write back data buffered by the driver (optional)
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
+#if defined(MODULE_MTD_ASYNC) || defined(DOXYGEN)
+    /**
+     * @brief   Read into several buffers from consecutive addresses (optional)
+     *
+     * @param[in]  dev      Pointer to the selected driver
+     * @param[out] iol      Buffers to fill, in address order
+     * @param[in]  addr     Starting address
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*readv)(mtd_dev_t *dev,
+                 const iolist_t *iol,
+                 uint32_t addr);
+
+    /**
+     * @brief   Write several buffers to consecutive addresses (optional)
+     *
+     * The same restrictions apply as for mtd_desc_t::write on the total size,
+     * so all data is programmed to the page in one operation.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] iol       Buffers to write, in address order
+     * @param[in] addr      Starting address
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*writev)(mtd_dev_t *dev,
+                  const iolist_t *iol,
+                  uint32_t addr);
+#endif
 };
 
 /**
@@ -231,6 +364,41 @@ int mtd_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t count);
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write back all data a MTD device still buffers
+ *
+ * File systems call this to make sure that their data reached the storage,
+ * e.g. on sync and unmount.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @return 0 on success, or if the device does not buffer data
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
+#if defined(MODULE_MTD_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   Queue a request on a MTD device
+ *
+ * Requests of a device are processed in the order they were submitted, by a
+ * thread with priority @ref CONFIG_MTD_ASYNC_PRIO. Do not use the blocking
+ * functions on a device while it has pending requests.
+ *
+ * @param      mtd   the device to access
+ * @param[in]  req   the request, mtd_req_t::op, mtd_req_t::buf,
+ *                   mtd_req_t::addr, mtd_req_t::count, mtd_req_t::cb and
+ *                   mtd_req_t::arg need to be set
+ *
+ * @return 0 if the request was queued
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -ENOTSUP if the operation is not supported on @p mtd
+ */
+int mtd_submit(mtd_dev_t *mtd, mtd_req_t *req);
+#endif
+
 #if defined(MODULE_VFS) || defined(DOXYGEN)
 /**
  * @brief   MTD driver for VFS
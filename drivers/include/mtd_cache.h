@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back page cache for MTD devices
+ *
+ * This MTD module keeps the most recently used pages of another MTD device in
+ * RAM and presents the result as a new MTD device with the same geometry.
+ * File systems often read the same metadata again and again and update it in
+ * small pieces, these accesses are served from RAM.
+ *
+ * Writes only modify the cached page. A modified page is written back to the
+ * device in one operation when it is evicted, or when @ref mtd_flush() is
+ * called. The file systems do the latter on @ref vfs_fsync() and on
+ * @ref vfs_umount(). When all lines are in use, the least recently used page
+ * is replaced.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * and put the cache in front of an existing MTD device:
+ *
+ * ```
+ * mtd_cache_t cache = MTD_CACHE_INIT(MTD_0);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry is taken from the backing device by @ref mtd_init().
+ *
+ * The `mtd_cache` shell command shows the statistics of all initialized
+ * caches.
+ *
+ * @warning Data that has not been flushed is lost on reset or power loss.
+ *
+ * @note    Writes are merged into the cached page the way flash memory
+ *          programs them: only bits set in the stored data can be cleared.
+ *          Backing devices that replace the data on write must only be
+ *          written to after an erase.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_config   MTD page cache compile configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Number of pages kept in RAM by each cache
+ */
+#ifndef CONFIG_MTD_CACHE_LINES
+#define CONFIG_MTD_CACHE_LINES      (4U)
+#endif
+
+/**
+ * @brief   Size of a cache line, must be at least the page size of the
+ *          backing device
+ *
+ * @ref mtd_init() fails with -EINVAL otherwise.
+ */
+#ifndef CONFIG_MTD_CACHE_PAGE_SIZE
+#define CONFIG_MTD_CACHE_PAGE_SIZE  (256U)
+#endif
+/** @} */
+
+/**
+ * @brief   Shortcut macro for initializing a @ref mtd_cache_t
+ */
+#define MTD_CACHE_INIT(_parent) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< page accesses served from RAM */
+    uint32_t misses;        /**< pages read from the device */
+    uint32_t writebacks;    /**< modified pages written to the device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   State of a cache line
+ */
+typedef struct {
+    uint32_t page;          /**< page held by the line */
+    uint32_t last_use;      /**< time stamp of the last access */
+    uint16_t dirty_start;   /**< first modified byte */
+    uint16_t dirty_end;     /**< end of the modified bytes, 0 if clean */
+    bool valid;             /**< line holds a page */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD page cache
+ */
+typedef struct mtd_cache {
+    mtd_dev_t mtd;                  /**< MTD context */
+    mtd_dev_t *parent;              /**< backing device */
+    struct mtd_cache *next;         /**< next initialized cache */
+    mutex_t lock;                   /**< guards the cache */
+    uint32_t clock;                 /**< source of the time stamps */
+    mtd_cache_stats_t stats;        /**< statistics */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_LINES];             /**< state */
+    uint8_t data[CONFIG_MTD_CACHE_LINES][CONFIG_MTD_CACHE_PAGE_SIZE]; /**< data */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Iterate over all initialized caches
+ *
+ * @param[in] last  the cache returned by the previous call, NULL to start
+ *
+ * @return  the next cache
+ * @return  NULL if there are no more caches
+ */
+mtd_cache_t *mtd_cache_iter(const mtd_cache_t *last);
+
+/**
+ * @brief   Get the number of modified pages in a cache
+ *
+ * @param[in] cache the cache
+ *
+ * @return  number of pages not yet written back
+ */
+unsigned mtd_cache_dirty(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -33,12 +33,14 @@
  */
 
 static int mtd_vfs_fstat(vfs_file_t *filp, struct stat *buf);
+static int mtd_vfs_fsync(vfs_file_t *filp);
 static off_t mtd_vfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static ssize_t mtd_vfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
 static ssize_t mtd_vfs_write(vfs_file_t *filp, const void *src, size_t nbytes);
 
 const vfs_file_ops_t mtd_vfs_ops = {
     .fstat = mtd_vfs_fstat,
+    .fsync = mtd_vfs_fsync,
     .lseek = mtd_vfs_lseek,
     .read  = mtd_vfs_read,
     .write = mtd_vfs_write,
@@ -58,6 +60,15 @@ static int mtd_vfs_fstat(vfs_file_t *filp, struct stat *buf)
     return 0;
 }
 
+static int mtd_vfs_fsync(vfs_file_t *filp)
+{
+    mtd_dev_t *mtd = filp->private_data.ptr;
+    if (mtd == NULL) {
+        return -EFAULT;
+    }
+    return mtd_flush(mtd);
+}
+
 static off_t mtd_vfs_lseek(vfs_file_t *filp, off_t off, int whence)
 {
     const mtd_dev_t *mtd = filp->private_data.ptr;
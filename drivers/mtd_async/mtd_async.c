@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd
+ * @{
+ *
+ * @file
+ * @brief       Queued requests for MTD devices
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "event/thread.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static event_queue_t _queue;
+static char _stack[CONFIG_MTD_ASYNC_STACKSIZE];
+
+void mtd_async_init(void)
+{
+    event_thread_init(&_queue, _stack, sizeof(_stack), CONFIG_MTD_ASYNC_PRIO);
+}
+
+static bool _mergeable(const mtd_dev_t *mtd, const mtd_req_t *first,
+                       const mtd_req_t *last, const mtd_req_t *next)
+{
+    if ((next->op != last->op) || (next->addr != last->addr + last->count)) {
+        return false;
+    }
+    switch (next->op) {
+    case MTD_REQ_READ:
+        return mtd->driver->readv != NULL;
+    case MTD_REQ_WRITE:
+        /* the merged data is programmed as one page */
+        return (mtd->driver->writev != NULL) &&
+               ((first->addr / mtd->page_size) ==
+                ((next->addr + next->count - 1) / mtd->page_size));
+    default:
+        return true;
+    }
+}
+
+/* take the next request and all requests that can be merged with it */
+static unsigned _pop_batch(mtd_dev_t *mtd, mtd_req_t **batch)
+{
+    unsigned num = 0;
+    unsigned state = irq_disable();
+
+    while (num < CONFIG_MTD_ASYNC_MERGE_MAX) {
+        clist_node_t *node = clist_lpeek(&mtd->queue);
+        if (node == NULL) {
+            break;
+        }
+        mtd_req_t *req = container_of(node, mtd_req_t, node);
+        if ((num > 0) && !_mergeable(mtd, batch[0], batch[num - 1], req)) {
+            break;
+        }
+        clist_lpop(&mtd->queue);
+        batch[num++] = req;
+    }
+    irq_restore(state);
+
+    return num;
+}
+
+static void _run_batch(mtd_dev_t *mtd, mtd_req_t **batch, unsigned num)
+{
+    const mtd_desc_t *driver = mtd->driver;
+    mtd_req_t *first = batch[0];
+    iolist_t iol[CONFIG_MTD_ASYNC_MERGE_MAX];
+    uint32_t count = 0;
+    int res;
+
+    for (unsigned i = 0; i < num; i++) {
+        iol[i].iol_next = (i + 1 < num) ? &iol[i + 1] : NULL;
+        iol[i].iol_base = batch[i]->buf;
+        iol[i].iol_len = batch[i]->count;
+        count += batch[i]->count;
+    }
+
+    DEBUG("mtd_async: op %u at 0x%" PRIx32 ", %" PRIu32 " bytes in %u requests\n",
+          (unsigned)first->op, first->addr, count, num);
+
+    switch (first->op) {
+    case MTD_REQ_READ:
+        res = (num > 1) ? driver->readv(mtd, iol, first->addr)
+                        : mtd_read(mtd, first->buf, first->addr, count);
+        break;
+    case MTD_REQ_WRITE:
+        res = (num > 1) ? driver->writev(mtd, iol, first->addr)
+                        : mtd_write(mtd, first->buf, first->addr, count);
+        break;
+    case MTD_REQ_ERASE:
+        res = mtd_erase(mtd, first->addr, count);
+        break;
+    default:
+        res = -ENOTSUP;
+    }
+
+    for (unsigned i = 0; i < num; i++) {
+        batch[i]->res = res;
+        if (batch[i]->cb) {
+            batch[i]->cb(batch[i]);
+        }
+    }
+}
+
+static void _process(event_t *event)
+{
+    mtd_dev_t *mtd = container_of(event, mtd_dev_t, event);
+    mtd_req_t *batch[CONFIG_MTD_ASYNC_MERGE_MAX];
+    unsigned num;
+
+    while ((num = _pop_batch(mtd, batch)) > 0) {
+        _run_batch(mtd, batch, num);
+    }
+}
+
+int mtd_submit(mtd_dev_t *mtd, mtd_req_t *req)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    switch (req->op) {
+    case MTD_REQ_READ:
+        if (!mtd->driver->read) {
+            return -ENOTSUP;
+        }
+        break;
+    case MTD_REQ_WRITE:
+        if (!mtd->driver->write) {
+            return -ENOTSUP;
+        }
+        break;
+    case MTD_REQ_ERASE:
+        if (!mtd->driver->erase) {
+            return -ENOTSUP;
+        }
+        break;
+    default:
+        return -ENOTSUP;
+    }
+
+    unsigned state = irq_disable();
+    mtd->event.handler = _process;
+    clist_rpush(&mtd->queue, &req->node);
+    irq_restore(state);
+
+    event_post(&_queue, &mtd->event);
+
+    return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back page cache for MTD devices
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mtd_cache.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static_assert(CONFIG_MTD_CACHE_PAGE_SIZE <= UINT16_MAX,
+              "CONFIG_MTD_CACHE_PAGE_SIZE must fit the dirty range");
+
+static mtd_cache_t *_caches;
+
+static uint32_t _size(mtd_cache_t *cache)
+{
+    return cache->mtd.page_size * cache->mtd.pages_per_sector *
+           cache->mtd.sector_count;
+}
+
+static bool _registered(mtd_cache_t *cache)
+{
+    for (mtd_cache_t *c = _caches; c; c = c->next) {
+        if (c == cache) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _writeback(mtd_cache_t *cache, unsigned idx)
+{
+    mtd_cache_line_t *line = &cache->lines[idx];
+
+    if (line->dirty_end == 0) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back page %" PRIu32 " [%u, %u)\n",
+          line->page, line->dirty_start, line->dirty_end);
+
+    int res = mtd_write(cache->parent, &cache->data[idx][line->dirty_start],
+                        line->page * cache->mtd.page_size + line->dirty_start,
+                        line->dirty_end - line->dirty_start);
+    if (res < 0) {
+        return res;
+    }
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    cache->stats.writebacks++;
+    return 0;
+}
+
+/* find the line holding @p page, load it into the least recently used line
+ * if it is not cached */
+static int _get_line(mtd_cache_t *cache, uint32_t page)
+{
+    unsigned victim = 0;
+
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && (line->page == page)) {
+            cache->stats.hits++;
+            line->last_use = ++cache->clock;
+            return i;
+        }
+        if (!line->valid) {
+            if (cache->lines[victim].valid) {
+                victim = i;
+            }
+        }
+        else if (cache->lines[victim].valid &&
+                 (line->last_use < cache->lines[victim].last_use)) {
+            victim = i;
+        }
+    }
+
+    mtd_cache_line_t *line = &cache->lines[victim];
+    int res = _writeback(cache, victim);
+    if (res < 0) {
+        return res;
+    }
+
+    cache->stats.misses++;
+    line->valid = false;
+    res = mtd_read(cache->parent, cache->data[victim],
+                   page * cache->mtd.page_size, cache->mtd.page_size);
+    if (res < 0) {
+        return res;
+    }
+    line->page = page;
+    line->last_use = ++cache->clock;
+    line->valid = true;
+    return victim;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    if (parent->page_size > CONFIG_MTD_CACHE_PAGE_SIZE) {
+        DEBUG("mtd_cache: page size %" PRIu32 " exceeds the cache lines\n",
+              parent->page_size);
+        return -EINVAL;
+    }
+
+    mutex_lock(&cache->lock);
+    /* file systems initialize the device on every mount, the cached pages
+     * stay valid then */
+    if (!_registered(cache)) {
+        mtd->sector_count = parent->sector_count;
+        mtd->pages_per_sector = parent->pages_per_sector;
+        mtd->page_size = parent->page_size;
+        memset(cache->lines, 0, sizeof(cache->lines));
+
+        unsigned state = irq_disable();
+        cache->next = _caches;
+        _caches = cache;
+        irq_restore(state);
+    }
+    mutex_unlock(&cache->lock);
+
+    return 0;
+}
+
+static int _read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint8_t *dst = dest;
+    int res = 0;
+
+    if (addr + count > _size(cache)) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    while (count > 0) {
+        uint32_t offset = addr % mtd->page_size;
+        uint32_t len = mtd->page_size - offset;
+
+        if (len > count) {
+            len = count;
+        }
+
+        res = _get_line(cache, addr / mtd->page_size);
+        if (res < 0) {
+            break;
+        }
+        memcpy(dst, &cache->data[res][offset], len);
+        dst += len;
+        addr += len;
+        count -= len;
+        res = 0;
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _write(mtd_dev_t *mtd, const void *src, uint32_t addr,
+                  uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t offset = addr % mtd->page_size;
+
+    if (addr + count > _size(cache)) {
+        return -EOVERFLOW;
+    }
+    if (offset + count > mtd->page_size) {
+        return -EOVERFLOW;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    mutex_lock(&cache->lock);
+    int res = _get_line(cache, addr / mtd->page_size);
+    if (res >= 0) {
+        mtd_cache_line_t *line = &cache->lines[res];
+        uint8_t *data = &cache->data[res][offset];
+        const uint8_t *in = src;
+
+        /* programming flash only clears bits, mirror what the device would
+         * store */
+        for (uint32_t i = 0; i < count; i++) {
+            data[i] &= in[i];
+        }
+        if ((line->dirty_end == 0) || (offset < line->dirty_start)) {
+            line->dirty_start = offset;
+        }
+        if (offset + count > line->dirty_end) {
+            line->dirty_end = offset + count;
+        }
+        res = 0;
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _erase(mtd_dev_t *mtd, uint32_t addr, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (addr + count > _size(cache)) {
+        return -EOVERFLOW;
+    }
+
+    uint32_t first = addr / mtd->page_size;
+    uint32_t end = (addr + count) / mtd->page_size;
+
+    mutex_lock(&cache->lock);
+    /* pending writes to the erased pages are void */
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+        if (line->valid && (line->page >= first) && (line->page < end)) {
+            line->valid = false;
+            line->dirty_end = 0;
+        }
+    }
+    int res = mtd_erase(cache->parent, addr, count);
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; (i < CONFIG_MTD_CACHE_LINES) && (res == 0); i++) {
+        res = _writeback(cache, i);
+    }
+    if (res == 0) {
+        res = mtd_flush(cache->parent);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return mtd_power(cache->parent, power);
+}
+
+mtd_cache_t *mtd_cache_iter(const mtd_cache_t *last)
+{
+    return (last == NULL) ? _caches : last->next;
+}
+
+unsigned mtd_cache_dirty(mtd_cache_t *cache)
+{
+    unsigned num = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        if (cache->lines[i].dirty_end > 0) {
+            num++;
+        }
+    }
+    mutex_unlock(&cache->lock);
+
+    return num;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read = _read,
+    .write = _write,
+    .erase = _erase,
+    .power = _power,
+    .flush = _flush,
+};
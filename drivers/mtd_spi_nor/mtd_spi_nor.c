@@ -74,6 +74,10 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
 static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uint32_t size);
 static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size);
 static int mtd_spi_nor_power(mtd_dev_t *mtd, enum mtd_power_state power);
+#ifdef MODULE_MTD_ASYNC
+static int mtd_spi_nor_readv(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr);
+static int mtd_spi_nor_writev(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr);
+#endif
 
 const mtd_desc_t mtd_spi_nor_driver = {
     .init = mtd_spi_nor_init,
@@ -81,6 +85,10 @@ const mtd_desc_t mtd_spi_nor_driver = {
     .write = mtd_spi_nor_write,
     .erase = mtd_spi_nor_erase,
     .power = mtd_spi_nor_power,
+#ifdef MODULE_MTD_ASYNC
+    .readv = mtd_spi_nor_readv,
+    .writev = mtd_spi_nor_writev,
+#endif
 };
 
 static void mtd_spi_acquire(const mtd_spi_nor_t *dev)
@@ -521,6 +529,96 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
     return 0;
 }
 
+#ifdef MODULE_MTD_ASYNC
+/**
+ * @internal
+ * @brief Send command opcode followed by address, followed by a transfer
+ *        from or to several buffers in one transaction
+ *
+ * @param[in]  dev    pointer to device descriptor
+ * @param[in]  opcode command opcode
+ * @param[in]  addr   address (big endian)
+ * @param[in]  iol    buffers
+ * @param[in]  read   true to read into the buffers, false to write them
+ */
+static void mtd_spi_cmd_addr_iolist(const mtd_spi_nor_t *dev, uint8_t opcode,
+                                    be_uint32_t addr, const iolist_t *iol, bool read)
+{
+    uint8_t *addr_buf = &addr.u8[4 - dev->params->addr_width];
+
+    spi_transfer_byte(dev->params->spi, dev->params->cs, true, opcode);
+    spi_transfer_bytes(dev->params->spi, dev->params->cs, true,
+                       (char *)addr_buf, NULL, dev->params->addr_width);
+    for (; iol; iol = iol->iol_next) {
+        spi_transfer_bytes(dev->params->spi, dev->params->cs, iol->iol_next != NULL,
+                           read ? NULL : iol->iol_base,
+                           read ? iol->iol_base : NULL, iol->iol_len);
+    }
+}
+
+static int mtd_spi_nor_readv(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    size_t chipsize = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
+    uint32_t size = iolist_size(iol);
+
+    DEBUG("mtd_spi_nor_readv: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, (void *)iol, addr, size);
+    if ((addr + size) > chipsize) {
+        return -EOVERFLOW;
+    }
+    if (size == 0) {
+        return 0;
+    }
+    be_uint32_t addr_be = byteorder_htonl(addr);
+
+    mtd_spi_acquire(dev);
+    mtd_spi_cmd_addr_iolist(dev, dev->params->opcode->read, addr_be, iol, true);
+    mtd_spi_release(dev);
+
+    return 0;
+}
+
+static int mtd_spi_nor_writev(mtd_dev_t *mtd, const iolist_t *iol, uint32_t addr)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint32_t total_size = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
+    uint32_t size = iolist_size(iol);
+
+    DEBUG("mtd_spi_nor_writev: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, (void *)iol, addr, size);
+    if (size == 0) {
+        return 0;
+    }
+    if (size > mtd->page_size) {
+        DEBUG("mtd_spi_nor_writev: ERR: page program >1 page (%" PRIu32 ")!\n", mtd->page_size);
+        return -EOVERFLOW;
+    }
+    if (dev->page_addr_mask &&
+        ((addr & dev->page_addr_mask) != ((addr + size - 1) & dev->page_addr_mask))) {
+        DEBUG("mtd_spi_nor_writev: ERR: page program spans page boundary!\n");
+        return -EOVERFLOW;
+    }
+    if (addr + size > total_size) {
+        return -EOVERFLOW;
+    }
+    be_uint32_t addr_be = byteorder_htonl(addr);
+
+    mtd_spi_acquire(dev);
+    /* write enable */
+    mtd_spi_cmd(dev, dev->params->opcode->wren);
+
+    /* all buffers are programmed in one page program cycle */
+    mtd_spi_cmd_addr_iolist(dev, dev->params->opcode->page_program, addr_be, iol, false);
+
+    /* waiting for the command to complete before returning */
+    wait_for_write_complete(dev, 0);
+
+    mtd_spi_release(dev);
+    return 0;
+}
+#endif /* MODULE_MTD_ASYNC */
+
 static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
 {
     DEBUG("mtd_spi_nor_erase: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
@@ -127,6 +127,12 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             stm32_eth_get_mac((char *)value);
             res = ETHERNET_ADDR_LEN;
             break;
+        case NETOPT_TX_CSUM_OFFLOAD:
+            /* the TX descriptors are set up for full checksum insertion */
+            assert(max_len >= sizeof(netopt_enable_t));
+            *((netopt_enable_t *)value) = NETOPT_ENABLE;
+            res = sizeof(netopt_enable_t);
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -40,6 +40,9 @@ PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_cmd_%
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_rx_batch
+PSEUDOMODULES += gnrc_netif_tx_sched
+PSEUDOMODULES += gnrc_netreg_hash
 PSEUDOMODULES += gnrc_nettype_%
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
@@ -51,6 +54,7 @@ PSEUDOMODULES += gnrc_sixlowpan_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_tcp_sack
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += heap_cmd
 PSEUDOMODULES += i2c_scan
@@ -241,6 +245,15 @@ PSEUDOMODULES += ds18_optimized
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Keep the expanded AES key in the cipher context (more RAM, less CPU)
+PSEUDOMODULES += crypto_aes_key_schedule
+# Use the AES instructions of x86 CPUs on native
+PSEUDOMODULES += crypto_aes_ni
+
+# Unroll the SHA-224/SHA-256 rounds (more flash, less CPU)
+PSEUDOMODULES += hashes_sha256_unroll
+# Use the SHA instructions of x86 CPUs on native for SHA-224/SHA-256
+PSEUDOMODULES += hashes_sha_ni
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
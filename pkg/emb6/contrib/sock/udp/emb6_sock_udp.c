@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "byteorder.h"
 #include "evproc.h"
@@ -268,6 +269,33 @@ int sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     return send_cmd.res;
 }
 
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote)
+{
+    /* uIP can only send from a single buffer, so the snips are gathered into
+     * a buffer of the maximum payload size first */
+    static uint8_t buf[UIP_BUFSIZE - (UIP_LLH_LEN + UIP_IPUDPH_LEN)];
+    static mutex_t buf_lock = MUTEX_INIT;
+    size_t len = iolist_size(snips);
+    uint8_t *ptr = buf;
+    int res;
+
+    assert((sock != NULL) || (remote != NULL));
+    if (len > sizeof(buf)) {
+        return -ENOMEM;
+    }
+    mutex_lock(&buf_lock);
+    for (const iolist_t *snip = snips; snip != NULL; snip = snip->iol_next) {
+        if (snip->iol_len > 0) {
+            memcpy(ptr, snip->iol_base, snip->iol_len);
+            ptr += snip->iol_len;
+        }
+    }
+    res = sock_udp_send(sock, buf, len, remote);
+    mutex_unlock(&buf_lock);
+    return res;
+}
+
 static void _timeout_callback(void *arg)
 {
     msg_t msg = { .type = _MSG_TYPE_TIMEOUT };
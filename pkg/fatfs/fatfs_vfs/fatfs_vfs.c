@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "fs/fatfs.h"
+#include "fatfs/diskio.h"
 
 #include "kernel_defines.h" /* needed for BUILD_BUG_ON */
 #include "time.h"
@@ -87,6 +88,10 @@ static int _umount(vfs_mount_t *mountp)
     if (res == FR_OK) {
         DEBUG("[OK]");
         memset(&fs_desc->fat_fs, 0, sizeof(fs_desc->fat_fs));
+        /* the device may still buffer data written before */
+        if (disk_ioctl(fs_desc->vol_idx, CTRL_SYNC, NULL) != RES_OK) {
+            return -EIO;
+        }
     }
     else {
         DEBUG("[ERROR]");
@@ -191,6 +196,16 @@ static int _close(vfs_file_t *filp)
     return fatfs_err_to_errno(res);
 }
 
+static int _fsync(vfs_file_t *filp)
+{
+    fatfs_file_desc_t *fd = (fatfs_file_desc_t *)filp->private_data.buffer;
+
+    DEBUG("fatfs_vfs.c: _fsync: private_data = %p\n", filp->mp->private_data);
+
+    /* also issues CTRL_SYNC to the disk */
+    return fatfs_err_to_errno(f_sync(&fd->file));
+}
+
 static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     fatfs_file_desc_t *fd = (fatfs_file_desc_t *)filp->private_data.buffer;
@@ -448,6 +463,7 @@ static const vfs_file_system_ops_t fatfs_fs_ops = {
 static const vfs_file_ops_t fatfs_file_ops = {
     .open = _open,
     .close = _close,
+    .fsync = _fsync,
     .read = _read,
     .write = _write,
     .lseek = _lseek,
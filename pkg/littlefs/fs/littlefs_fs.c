@@ -114,9 +114,16 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs_desc_t *fs = c->context;
 
-    return 0;
+    DEBUG("lfs_sync: c=%p\n", (void *)c);
+
+    int ret = mtd_flush(fs->dev);
+    if (ret >= 0) {
+        return 0;
+    }
+
+    return ret;
 }
 
 static int prepare(littlefs_desc_t *fs)
@@ -210,6 +217,9 @@ static int _umount(vfs_mount_t *mountp)
     DEBUG("littlefs: umount: mountp=%p\n", (void *)mountp);
 
     int ret = lfs_unmount(&fs->fs);
+    if (ret == 0) {
+        ret = mtd_flush(fs->dev);
+    }
     mutex_unlock(&fs->lock);
 
     return littlefs_err_to_errno(ret);
@@ -333,6 +343,21 @@ static int _close(vfs_file_t *filp)
     return littlefs_err_to_errno(ret);
 }
 
+static int _fsync(vfs_file_t *filp)
+{
+    littlefs_desc_t *fs = filp->mp->private_data;
+    lfs_file_t *fp = (lfs_file_t *)&filp->private_data.buffer;
+
+    mutex_lock(&fs->lock);
+
+    DEBUG("littlefs: fsync: filp=%p, fp=%p\n", (void *)filp, (void *)fp);
+
+    int ret = lfs_file_sync(&fs->fs, fp);
+    mutex_unlock(&fs->lock);
+
+    return littlefs_err_to_errno(ret);
+}
+
 static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     littlefs_desc_t *fs = filp->mp->private_data;
@@ -511,6 +536,7 @@ static const vfs_file_system_ops_t littlefs_fs_ops = {
 static const vfs_file_ops_t littlefs_file_ops = {
     .open = _open,
     .close = _close,
+    .fsync = _fsync,
     .read = _read,
     .write = _write,
     .lseek = _lseek,
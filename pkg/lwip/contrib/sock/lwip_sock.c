@@ -562,10 +562,23 @@ int lwip_sock_recv(struct netconn *conn, uint32_t timeout, struct netbuf **buf)
 
 ssize_t lwip_sock_send(struct netconn *conn, const void *data, size_t len,
                        int proto, const struct _sock_tl_ep *remote, int type)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len = len,
+    };
+
+    return lwip_sock_sendv(conn, &snip, proto, remote, type);
+}
+
+ssize_t lwip_sock_sendv(struct netconn *conn, const iolist_t *snips,
+                        int proto, const struct _sock_tl_ep *remote, int type)
 {
     ip_addr_t remote_addr;
     struct netconn *tmp;
     struct netbuf *buf;
+    size_t len = iolist_size(snips);
+    u16_t offset = 0;
     int res;
     err_t err;
     u16_t remote_port = 0;
@@ -585,11 +598,19 @@ ssize_t lwip_sock_send(struct netconn *conn, const void *data, size_t len,
     }
 
     buf = netbuf_new();
-    if ((buf == NULL) || (netbuf_alloc(buf, len) == NULL) ||
-        (netbuf_take(buf, data, len) != ERR_OK)) {
+    if ((buf == NULL) || (netbuf_alloc(buf, len) == NULL)) {
         netbuf_delete(buf);
         return -ENOMEM;
     }
+    for (const iolist_t *snip = snips; snip != NULL; snip = snip->iol_next) {
+        if ((snip->iol_len > 0) &&
+            (pbuf_take_at(buf->p, snip->iol_base, snip->iol_len,
+                          offset) != ERR_OK)) {
+            netbuf_delete(buf);
+            return -ENOMEM;
+        }
+        offset += snip->iol_len;
+    }
     if ((conn == NULL) && (remote != NULL)) {
         if ((res = _create(type, proto, 0, &tmp)) < 0) {
             netbuf_delete(buf);
@@ -618,7 +639,20 @@ ssize_t lwip_sock_send(struct netconn *conn, const void *data, size_t len,
     }
 #if LWIP_TCP
     else if (tmp->type & NETCONN_TCP) {
-        err = netconn_write_partly(tmp, data, len, 0, (size_t *)(&res));
+        res = 0;
+        err = ERR_OK;
+        for (const iolist_t *snip = snips; snip != NULL;
+             snip = snip->iol_next) {
+            size_t written = 0;
+
+            err = netconn_write_partly(tmp, snip->iol_base, snip->iol_len,
+                                       (snip->iol_next) ? NETCONN_MORE : 0,
+                                       &written);
+            res += written;
+            if ((err != ERR_OK) || (written < snip->iol_len)) {
+                break;
+            }
+        }
     }
 #endif /* LWIP_TCP */
     else {
@@ -164,6 +164,18 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote)
+{
+    assert((sock != NULL) || (remote != NULL));
+
+    if ((remote != NULL) && (remote->port == 0)) {
+        return -EINVAL;
+    }
+    return lwip_sock_sendv((sock) ? sock->base.conn : NULL, snips, 0,
+                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -85,6 +85,16 @@ static int32_t _dev_erase(u32_t addr, u32_t size)
 }
 #endif
 
+static mtd_dev_t *_dev(spiffs_desc_t *fs_desc)
+{
+#if SPIFFS_HAL_CALLBACK_EXTRA == 1
+    return fs_desc->dev;
+#else
+    (void)fs_desc;
+    return SPIFFS_MTD_DEV;
+#endif
+}
+
 void spiffs_lock(struct spiffs_t *fs)
 {
     spiffs_desc_t *fs_desc = container_of(fs, spiffs_desc_t, fs);
@@ -203,7 +213,7 @@ static int _umount(vfs_mount_t *mountp)
 
     SPIFFS_unmount(&fs_desc->fs);
 
-    return 0;
+    return mtd_flush(_dev(fs_desc));
 }
 
 static int _unlink(vfs_mount_t *mountp, const char *name)
@@ -300,6 +310,18 @@ static int _close(vfs_file_t *filp)
     return spiffs_err_to_errno(SPIFFS_close(&fs_desc->fs, filp->private_data.value));
 }
 
+static int _fsync(vfs_file_t *filp)
+{
+    spiffs_desc_t *fs_desc = filp->mp->private_data;
+
+    int res = SPIFFS_fflush(&fs_desc->fs, filp->private_data.value);
+    if (res < 0) {
+        return spiffs_err_to_errno(res);
+    }
+
+    return mtd_flush(_dev(fs_desc));
+}
+
 static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     spiffs_desc_t *fs_desc = filp->mp->private_data;
@@ -503,6 +525,7 @@ static const vfs_file_system_ops_t spiffs_fs_ops = {
 static const vfs_file_ops_t spiffs_file_ops = {
     .open = _open,
     .close = _close,
+    .fsync = _fsync,
     .read = _read,
     .write = _write,
     .lseek = _lseek,
@@ -220,6 +220,12 @@ void auto_init(void)
         }
     }
 
+    if (IS_USED(MODULE_MTD_ASYNC)) {
+        LOG_DEBUG("Auto init mtd_async.\n");
+        extern void mtd_async_init(void);
+        mtd_async_init();
+    }
+
 
     if (IS_USED(MODULE_AUTO_INIT_CAN)) {
         LOG_DEBUG("Auto init CAN.\n");
@@ -52,7 +52,7 @@ typedef struct filter_el {
 } filter_el_t;
 
 /**
- * This table contains @p CAN_ROUTER_APP_MAX lists of CAN IDs per interface
+ * This table contains the filters of each interface which are not hashed
  */
 static can_reg_entry_t *table[CAN_DLL_NUMOF];
 
@@ -60,28 +60,62 @@ static can_reg_entry_t *table[CAN_DLL_NUMOF];
 #define CAN_ROUTER_MAX_FILTER   64
 #endif
 
+#if CAN_ROUTER_MASK_CLASSES
+#define HASH_MASK   (CAN_ROUTER_HASH_BUCKETS - 1)
+
+static_assert((CAN_ROUTER_HASH_BUCKETS & HASH_MASK) == 0,
+              "CAN_ROUTER_HASH_BUCKETS must be a power of two");
+
+/**
+ * This is a mask shared by hashed filters of an interface
+ */
+typedef struct {
+    canid_t mask;            /**< Mask of the filters */
+    unsigned refs;           /**< Number of hashed filters, 0 if unused */
+} mask_class_t;
+
+static mask_class_t _classes[CAN_DLL_NUMOF][CAN_ROUTER_MASK_CLASSES];
+static can_reg_entry_t *_buckets[CAN_ROUTER_HASH_BUCKETS];
+#endif
+
 static filter_el_t _filter_buf[CAN_ROUTER_MAX_FILTER];
 static memarray_t _filter_array;
 static mutex_t lock = MUTEX_INIT;
 
 static filter_el_t *_alloc_filter_el(canid_t can_id, canid_t mask, void *data);
 static void _free_filter_el(filter_el_t *el);
-static void _insert_to_list(can_reg_entry_t **list, filter_el_t *el);
+static void _insert_filter_el(filter_el_t *el);
+static void _remove_filter_el(filter_el_t *el);
+static can_reg_entry_t **_get_list(unsigned int ifnum, canid_t can_id, canid_t mask);
 static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *data);
 static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask);
 
 #if ENABLE_DEBUG
+static void _print_filter_el(filter_el_t *el)
+{
+    DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32 ", data=%p\n",
+          el->entry.target.pid, (void*)el, el->can_id, el->mask, el->data);
+}
+
 static void _print_filters(void)
 {
+    can_reg_entry_t *entry;
+
     for (int i = 0; i < (int)CAN_DLL_NUMOF; i++) {
         DEBUG("--- Ifnum: %d ---\n", i);
-        can_reg_entry_t *entry;
         LL_FOREACH(table[i], entry) {
-            filter_el_t *el = container_of(entry, filter_el_t, entry);
-            DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32 ", data=%p\n",
-                  el->entry.target.pid, (void*)el, el->can_id, el->mask, el->data);
+            _print_filter_el(container_of(entry, filter_el_t, entry));
         }
     }
+#if CAN_ROUTER_MASK_CLASSES
+    DEBUG("--- Hashed ---\n");
+    for (unsigned i = 0; i < CAN_ROUTER_HASH_BUCKETS; i++) {
+        LL_FOREACH(_buckets[i], entry) {
+            DEBUG("ifnum=%d, ", entry->ifnum);
+            _print_filter_el(container_of(entry, filter_el_t, entry));
+        }
+    }
+#endif
 }
 
 #define PRINT_FILTERS() _print_filters()
@@ -123,40 +157,125 @@ static void _free_filter_el(filter_el_t *el)
     memarray_free(&_filter_array, el);
 }
 
-/* Insert to the list in a sorted way
- * Lower CAN IDs are inserted first */
-static void _insert_to_list(can_reg_entry_t **list, filter_el_t *el)
+#if CAN_ROUTER_MASK_CLASSES
+static can_reg_entry_t **_get_bucket(unsigned int ifnum, canid_t can_id, canid_t mask)
 {
-    can_reg_entry_t *next_entry = *list;
-    filter_el_t *next_el = container_of(next_entry, filter_el_t, entry);
+    /* multiplicative hashing, the middle bits of the product are mixed best */
+    uint32_t h = (can_id ^ (mask << 11) ^ ifnum) * 0x9e3779b1U;
+
+    return &_buckets[(h >> 16) & HASH_MASK];
+}
 
-    DEBUG("_insert_to_list: list=%p, el=%p\n", (void *)list, (void *)el);
+/* Only filters matching a single identifier are worth hashing */
+static inline int _mask_is_exact(canid_t mask)
+{
+    return (mask & CAN_SFF_MASK) == CAN_SFF_MASK;
+}
 
-    if (!(*list) || (next_el->can_id > el->can_id)) {
-        LL_PREPEND(*list, &el->entry);
-        DEBUG("_insert_to_list: inserting first el, list=%p\n", (void *)list);
+static mask_class_t *_find_class(unsigned int ifnum, canid_t mask)
+{
+    for (unsigned i = 0; i < CAN_ROUTER_MASK_CLASSES; i++) {
+        mask_class_t *class = &_classes[ifnum][i];
+        if (class->refs && (class->mask == mask)) {
+            return class;
+        }
     }
-    else {
-        do {
-            if (el->can_id <= next_el->can_id) {
-                DEBUG("_insert_to_list: found next_el can_id:0x%" PRIx32
-                      "\n", next_el->can_id);
-                LL_PREPEND_ELEM(*list, next_entry, &el->entry);
-                return;
-            }
-            else if (next_el->entry.next == NULL) {
-                DEBUG("_insert_to_list: insert at the end\n");
-                LL_APPEND(next_entry, &el->entry);
-                return;
-            }
-            else {
-                next_entry = next_entry->next;
-                next_el = container_of(next_entry, filter_el_t, entry);
-                DEBUG("_insert_to_list: going to next el: %p\n", (void*) next_el);
-            }
-        } while (next_el);
+    return NULL;
+}
+
+/* Assign @p mask to an unused class and move the filters using it to the
+ * hash table */
+static mask_class_t *_claim_class(unsigned int ifnum, mask_class_t *class, canid_t mask)
+{
+    can_reg_entry_t *entry, *tmp;
+
+    DEBUG("_claim_class: ifnum=%u, mask=0x%" PRIx32 "\n", ifnum, mask);
+    class->mask = mask;
+    LL_FOREACH_SAFE(table[ifnum], entry, tmp) {
+        filter_el_t *el = container_of(entry, filter_el_t, entry);
+        if (el->mask == mask) {
+            LL_DELETE(table[ifnum], entry);
+            LL_PREPEND(*_get_bucket(ifnum, el->can_id, mask), entry);
+            class->refs++;
+        }
+    }
+    return class;
+}
 
+static mask_class_t *_alloc_class(unsigned int ifnum, canid_t mask)
+{
+    for (unsigned i = 0; i < CAN_ROUTER_MASK_CLASSES; i++) {
+        mask_class_t *class = &_classes[ifnum][i];
+        if (!class->refs) {
+            return _claim_class(ifnum, class, mask);
+        }
     }
+    return NULL;
+}
+
+/* Hand a freed class to the first listed filter which could be hashed */
+static void _refill_class(unsigned int ifnum, mask_class_t *class)
+{
+    can_reg_entry_t *entry;
+
+    LL_FOREACH(table[ifnum], entry) {
+        filter_el_t *el = container_of(entry, filter_el_t, entry);
+        if (_mask_is_exact(el->mask)) {
+            _claim_class(ifnum, class, el->mask);
+            return;
+        }
+    }
+}
+#endif
+
+static can_reg_entry_t **_get_list(unsigned int ifnum, canid_t can_id, canid_t mask)
+{
+#if CAN_ROUTER_MASK_CLASSES
+    if (_find_class(ifnum, mask)) {
+        return _get_bucket(ifnum, can_id, mask);
+    }
+#else
+    (void)can_id;
+    (void)mask;
+#endif
+    return &table[ifnum];
+}
+
+static void _insert_filter_el(filter_el_t *el)
+{
+    unsigned int ifnum = el->entry.ifnum;
+
+    DEBUG("_insert_filter_el: ifnum=%u, el=%p\n", ifnum, (void *)el);
+
+#if CAN_ROUTER_MASK_CLASSES
+    mask_class_t *class = _find_class(ifnum, el->mask);
+    if (!class && _mask_is_exact(el->mask)) {
+        class = _alloc_class(ifnum, el->mask);
+    }
+    if (class) {
+        LL_PREPEND(*_get_bucket(ifnum, el->can_id, el->mask), &el->entry);
+        class->refs++;
+        return;
+    }
+#endif
+    LL_PREPEND(table[ifnum], &el->entry);
+}
+
+static void _remove_filter_el(filter_el_t *el)
+{
+    unsigned int ifnum = el->entry.ifnum;
+
+#if CAN_ROUTER_MASK_CLASSES
+    mask_class_t *class = _find_class(ifnum, el->mask);
+    if (class) {
+        LL_DELETE(*_get_bucket(ifnum, el->can_id, el->mask), &el->entry);
+        if (--class->refs == 0) {
+            _refill_class(ifnum, class);
+        }
+        return;
+    }
+#endif
+    LL_DELETE(table[ifnum], &el->entry);
 }
 
 #ifdef MODULE_CAN_MBOX
@@ -169,38 +288,33 @@ static void _insert_to_list(can_reg_entry_t **list, filter_el_t *el)
 
 static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *data)
 {
-    filter_el_t *el = container_of(list, filter_el_t, entry);
-    if (!el) {
-        return el;
-    }
-    do {
+    can_reg_entry_t *cur;
+
+    LL_FOREACH(list, cur) {
+        filter_el_t *el = container_of(cur, filter_el_t, entry);
         if ((el->can_id == can_id) && (el->mask == mask) && (el->data == data) &&
-                ENTRY_MATCHES(&el->entry, entry)) {
+                (el->entry.ifnum == entry->ifnum) && ENTRY_MATCHES(&el->entry, entry)) {
             DEBUG("_find_filter_el: found el=%p, can_id=%" PRIx32 ", mask=%" PRIx32 ", data=%p\n",
                   (void *)el, el->can_id, el->mask, el->data);
             return el;
         }
-        el = container_of(el->entry.next, filter_el_t, entry);
-    }  while (el);
+    }
 
     return NULL;
 }
 
 static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask)
 {
-    filter_el_t *el = container_of(table[ifnum], filter_el_t, entry);
-    if (!el) {
-        DEBUG("_filter_is_used: empty list\n");
-        return 0;
-    }
-    do {
-        if ((el->can_id == can_id) && (el->mask == mask)) {
+    can_reg_entry_t *cur;
+
+    LL_FOREACH(*_get_list(ifnum, can_id, mask), cur) {
+        filter_el_t *el = container_of(cur, filter_el_t, entry);
+        if ((el->can_id == can_id) && (el->mask == mask) && ((unsigned int)el->entry.ifnum == ifnum)) {
             DEBUG("_filter_is_used: found el=%p, can_id=%" PRIx32 ", mask=%" PRIx32 ", data=%p\n",
                   (void *)el, el->can_id, el->mask, el->data);
             return 1;
         }
-        el = container_of(el->entry.next, filter_el_t, entry);
-    }  while (el);
+    }
 
     DEBUG("_filter_is_used: filter not found\n");
 
@@ -247,7 +361,7 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
     filter->entry.target.pid = entry->target.pid;
 #endif
     filter->entry.ifnum = entry->ifnum;
-    _insert_to_list(&table[entry->ifnum], filter);
+    _insert_filter_el(filter);
     mutex_unlock(&lock);
 
     PRINT_FILTERS();
@@ -273,12 +387,12 @@ int can_router_unregister(can_reg_entry_t *entry, canid_t can_id,
 #endif
 
     mutex_lock(&lock);
-    el = _find_filter_el(table[entry->ifnum], entry, can_id, mask, param);
+    el = _find_filter_el(*_get_list(entry->ifnum, can_id, mask), entry, can_id, mask, param);
     if (!el) {
         mutex_unlock(&lock);
         return -EINVAL;
     }
-    LL_DELETE(table[entry->ifnum], &el->entry);
+    _remove_filter_el(el);
     _free_filter_el(el);
     ret = _filter_is_used(entry->ifnum, can_id, mask);
     mutex_unlock(&lock);
@@ -305,6 +419,27 @@ static int _send_msg(msg_t *msg, can_reg_entry_t *entry)
 #endif
 }
 
+static int _dispatch_to(can_pkt_t *pkt, filter_el_t *el)
+{
+    msg_t msg;
+    msg.type = CAN_MSG_RX_INDICATION;
+
+    DEBUG("can_router_dispatch_rx_indic: found el=%p, data=%p\n",
+          (void *)el, (void *)el->data);
+    DEBUG("can_router_dispatch_rx_indic: rx_ind to pid: %"
+          PRIkernel_pid "\n", el->entry.target.pid);
+    atomic_fetch_add(&pkt->ref_count, 1);
+    msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
+    if (!msg.content.ptr || (_send_msg(&msg, &el->entry) <= 0)) {
+        can_pkt_free_rx_data(msg.content.ptr);
+        atomic_fetch_sub(&pkt->ref_count, 1);
+        DEBUG("can_router_dispatch_rx_indic: failed to send msg to "
+              "pid=%" PRIkernel_pid "\n", el->entry.target.pid);
+        return -EBUSY;
+    }
+    return 0;
+}
+
 /* send received pkt to all interested users */
 int can_router_dispatch_rx_indic(can_pkt_t *pkt)
 {
@@ -314,43 +449,42 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
     }
 
     int res = 0;
-    msg_t msg;
-    msg.type = CAN_MSG_RX_INDICATION;
-#if ENABLE_DEBUG
-    int msg_cnt = 0;
-#endif
+    int ifnum = pkt->entry.ifnum;
+    canid_t can_id = pkt->frame.can_id;
+    can_reg_entry_t *entry;
+    filter_el_t *el;
+
     DEBUG("can_router_dispatch_rx_indic: pkt=%p, ifnum=%d, can_id=%" PRIx32 "\n",
           (void *)pkt, pkt->entry.ifnum, pkt->frame.can_id);
 
     mutex_lock(&lock);
-    can_reg_entry_t *entry = NULL;
-    filter_el_t *el;
-    LL_FOREACH(table[pkt->entry.ifnum], entry) {
-        el = container_of(entry, filter_el_t, entry);
-        if ((pkt->frame.can_id & el->mask) == el->can_id) {
-            DEBUG("can_router_dispatch_rx_indic: found el=%p, data=%p\n",
-                  (void *)el, (void *)el->data);
-            DEBUG("can_router_dispatch_rx_indic: rx_ind to pid: %"
-                  PRIkernel_pid "\n", entry->target.pid);
-            atomic_fetch_add(&pkt->ref_count, 1);
-            msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
-#if ENABLE_DEBUG
-            msg_cnt++;
+#if CAN_ROUTER_MASK_CLASSES
+    /* one bucket per mask in use holds all hashed filters which can match */
+    for (unsigned i = 0; (res == 0) && (i < CAN_ROUTER_MASK_CLASSES); i++) {
+        mask_class_t *class = &_classes[ifnum][i];
+        if (!class->refs) {
+            continue;
+        }
+        canid_t masked_id = can_id & class->mask;
+        LL_FOREACH(*_get_bucket(ifnum, masked_id, class->mask), entry) {
+            el = container_of(entry, filter_el_t, entry);
+            if ((el->can_id == masked_id) && (el->mask == class->mask) &&
+                    (entry->ifnum == ifnum) && ((res = _dispatch_to(pkt, el)) < 0)) {
+                break;
+            }
+        }
+    }
 #endif
-            if (!msg.content.ptr || (_send_msg(&msg, entry) <= 0)) {
-                can_pkt_free_rx_data(msg.content.ptr);
-                atomic_fetch_sub(&pkt->ref_count, 1);
-                DEBUG("can_router_dispatch_rx_indic: failed to send msg to "
-                      "pid=%" PRIkernel_pid "\n", entry->target.pid);
-                res = -EBUSY;
+    if (res == 0) {
+        LL_FOREACH(table[ifnum], entry) {
+            el = container_of(entry, filter_el_t, entry);
+            if (((can_id & el->mask) == el->can_id) &&
+                    ((res = _dispatch_to(pkt, el)) < 0)) {
                 break;
             }
         }
     }
     mutex_unlock(&lock);
-#if ENABLE_DEBUG
-    DEBUG("can_router_dispatch_rx: msg send to %d threads\n", msg_cnt);
-#endif
     if (atomic_load(&pkt->ref_count) == 0) {
         can_pkt_free(pkt);
     }
@@ -32,13 +32,18 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
+#if IS_USED(MODULE_CRYPTO_AES_NI)
+#include "aes_ni.h"
+#endif
 
 /**
  * Interface to the aes cipher
@@ -48,10 +53,13 @@ static const cipher_interface_t aes_interface = {
     AES_KEY_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
+    aes_decrypt_blocks
 };
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
 
+#if !IS_USED(MODULE_CRYPTO_AES_NI)
 static const u32 Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
     0xfff2f20dU, 0xd66b6bbdU, 0xde6f6fb1U, 0x91c5c554U,
@@ -794,7 +802,24 @@ static const u32 rcon[] = {
     0x10000000, 0x20000000, 0x40000000, 0x80000000,
     0x1B000000, 0x36000000,
 };
+#endif /* !MODULE_CRYPTO_AES_NI */
+
+
+/* Number of rounds for the supported key size */
+#define AES_ROUNDS                  ((AES_KEY_SIZE / 4) + 6)
+
+/* Size of the encryption key schedule for the supported key size */
+#define AES_KEY_SCHEDULE_SIZE       (4 * sizeof(u32) * (AES_ROUNDS + 1))
 
+/* The expanded key is kept in the context, unless AES-NI expands it on the
+ * fly anyway */
+#define AES_CACHED_KEY_SCHEDULE     (IS_USED(MODULE_CRYPTO_AES_KEY_SCHEDULE) && \
+                                     !IS_USED(MODULE_CRYPTO_AES_NI))
+
+#if AES_CACHED_KEY_SCHEDULE
+static int aes_set_encrypt_key(const unsigned char *userKey, const int bits,
+                               AES_KEY *key);
+#endif
 
 int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
 {
@@ -811,6 +836,19 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
         return CIPHER_ERR_BAD_CONTEXT_SIZE;
     }
 
+#if AES_CACHED_KEY_SCHEDULE
+    static_assert(CIPHER_MAX_CONTEXT_SIZE >= AES_KEY_SCHEDULE_SIZE,
+                  "cipher context too small for the AES key schedule");
+    AES_KEY aeskey;
+    int res = aes_set_encrypt_key(key, AES_KEY_SIZE * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    memcpy(context->context, aeskey.rd_key, AES_KEY_SCHEDULE_SIZE);
+    return CIPHER_INIT_SUCCESS;
+#endif
+
     /* key must be at least CIPHERS_MAX_KEY_SIZE Bytes long */
     if (keySize < CIPHERS_MAX_KEY_SIZE) {
         /* fill up by concatenating key to as long as needed */
@@ -827,6 +865,7 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
     return CIPHER_INIT_SUCCESS;
 }
 
+#if !IS_USED(MODULE_CRYPTO_AES_NI)
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -946,16 +985,15 @@ static int aes_set_encrypt_key(const unsigned char *userKey, const int bits,
     return 0;
 }
 
+static void aes_invert_key(AES_KEY *key);
+
+#if !AES_CACHED_KEY_SCHEDULE
 /**
  * Expand the cipher key into the decryption key schedule.
  */
 static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
                                AES_KEY *key)
 {
-    u32 *rk;
-    int i, j;
-    u32 temp;
-
     /* first, start with an encryption schedule */
     int status;
 
@@ -965,6 +1003,20 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
         return status;
     }
 
+    aes_invert_key(key);
+    return 0;
+}
+#endif /* !AES_CACHED_KEY_SCHEDULE */
+
+/**
+ * Turn the encryption key schedule into the decryption key schedule.
+ */
+static void aes_invert_key(AES_KEY *key)
+{
+    u32 *rk;
+    int i, j;
+    u32 temp;
+
     rk = key->rd_key;
 
     /* invert the order of the round keys: */
@@ -1019,37 +1071,21 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
         }
 #endif
     }
-
-    return 0;
 }
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with the encryption key schedule rk
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const u32 *rk, int rounds,
+                           const uint8_t *plainBlock, uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
-    const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
     int r;
 #endif /* ?MODULE_CRYPTO_AES_UNROLL */
 
-    rk = key->rd_key;
-
     /*
      * map byte array block to cipher state
      * and add initial round key:
@@ -1141,7 +1177,7 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
     t3 = Te0(s3 >> 24) ^ Te1((s0 >> 16) & 0xff) ^ Te2((s1 >>  8) & 0xff) ^
          Te3(s2 & 0xff) ^ rk[39];
 
-    if (key->rounds > 10) {
+    if (rounds > 10) {
         /* round 10: */
         s0 = Te0(t0 >> 24) ^ Te1((t1 >> 16) & 0xff) ^ Te2((t2 >>  8) & 0xff) ^
              Te3(t3 & 0xff) ^ rk[40];
@@ -1161,7 +1197,7 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         t3 = Te0(s3 >> 24) ^ Te1((s0 >> 16) & 0xff) ^ Te2((s1 >>  8) & 0xff) ^
              Te3(s2 & 0xff) ^ rk[47];
 
-        if (key->rounds > 12) {
+        if (rounds > 12) {
             /* round 12: */
             s0 = Te0(t0 >> 24) ^ Te1((t1 >> 16) & 0xff) ^ Te2((t2 >>  8) &
                                                               0xff) ^ Te3(
@@ -1191,12 +1227,12 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         }
     }
 
-    rk += key->rounds << 2;
+    rk += rounds << 2;
 #else  /* !MODULE_CRYPTO_AES_UNROLL */
     /*
      * Nr - 1 full rounds:
      */
-    r = key->rounds >> 1;
+    r = rounds >> 1;
 
     while (1) {
         t0 =
@@ -1289,36 +1325,20 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
 /*
- * Decrypt a single block
+ * Decrypt a single block with the decryption key schedule rk
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+static void _decrypt_block(const u32 *rk, int rounds,
+                           const uint8_t *cipherBlock, uint8_t *plainBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-
-    if (res < 0) {
-        return res;
-    }
-
-    const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
     int r;
 #endif /* ?MODULE_CRYPTO_AES_UNROLL */
 
-    rk = key->rd_key;
-
     /*
      * map byte array block to cipher state
      * and add initial round key:
@@ -1410,7 +1430,7 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
     t3 = Td0(s3 >> 24) ^ Td1((s2 >> 16) & 0xff) ^ Td2((s1 >>  8) & 0xff) ^
          Td3(s0 & 0xff) ^ rk[39];
 
-    if (key->rounds > 10) {
+    if (rounds > 10) {
         /* round 10: */
         s0 = Td0(t0 >> 24) ^ Td1((t3 >> 16) & 0xff) ^ Td2((t2 >>  8) & 0xff) ^
              Td3(t1 & 0xff) ^ rk[40];
@@ -1430,7 +1450,7 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         t3 = Td0(s3 >> 24) ^ Td1((s2 >> 16) & 0xff) ^ Td2((s1 >>  8) & 0xff) ^
              Td3(s0 & 0xff) ^ rk[47];
 
-        if (key->rounds > 12) {
+        if (rounds > 12) {
             /* round 12: */
             s0 = Td0(t0 >> 24) ^ Td1((t3 >> 16) & 0xff) ^ Td2((t2 >>  8) & 0xff)
                  ^ Td3(t1 & 0xff) ^ rk[48];
@@ -1452,12 +1472,12 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         }
     }
 
-    rk += key->rounds << 2;
+    rk += rounds << 2;
 #else  /* !MODULE_CRYPTO_AES_UNROLL */
     /*
      * Nr - 1 full rounds:
      */
-    r = key->rounds >> 1;
+    r = rounds >> 1;
 
     while (1) {
         t0 =
@@ -1550,7 +1570,103 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
-    return 1;
 }
 
 #endif /* AES_ASM */
+
+/*
+ * Get the encryption key schedule, expand it into key if it is not cached
+ */
+static int _get_encrypt_key(const cipher_context_t *context, AES_KEY *key,
+                            const u32 **rk)
+{
+#if AES_CACHED_KEY_SCHEDULE
+    (void)key;
+    *rk = (const u32 *)(uintptr_t)context->context;
+    return 0;
+#else
+    *rk = key->rd_key;
+    return aes_set_encrypt_key(context->context, AES_KEY_SIZE * 8, key);
+#endif
+}
+
+/*
+ * Expand the decryption key schedule into key
+ */
+static int _get_decrypt_key(const cipher_context_t *context, AES_KEY *key)
+{
+#if AES_CACHED_KEY_SCHEDULE
+    memcpy(key->rd_key, context->context, AES_KEY_SCHEDULE_SIZE);
+    key->rounds = AES_ROUNDS;
+    aes_invert_key(key);
+    return 0;
+#else
+    return aes_set_decrypt_key(context->context, AES_KEY_SIZE * 8, key);
+#endif
+}
+#endif /* !MODULE_CRYPTO_AES_NI */
+
+int aes_encrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                       size_t numof)
+{
+#if IS_USED(MODULE_CRYPTO_AES_NI)
+    aes_ni_encrypt_blocks(context->context, plain_blocks, cipher_blocks, numof);
+#else
+    AES_KEY aeskey;
+    const u32 *rk;
+    int res = _get_encrypt_key(context, &aeskey, &rk);
+
+    if (res < 0) {
+        return res;
+    }
+    for (size_t i = 0; i < numof; i++) {
+        _encrypt_block(rk, AES_ROUNDS, plain_blocks, cipher_blocks);
+        plain_blocks += AES_BLOCK_SIZE;
+        cipher_blocks += AES_BLOCK_SIZE;
+    }
+#endif
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *cipher_blocks, uint8_t *plain_blocks,
+                       size_t numof)
+{
+#if IS_USED(MODULE_CRYPTO_AES_NI)
+    aes_ni_decrypt_blocks(context->context, cipher_blocks, plain_blocks, numof);
+#else
+    AES_KEY aeskey;
+    int res = _get_decrypt_key(context, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    for (size_t i = 0; i < numof; i++) {
+        _decrypt_block(aeskey.rd_key, AES_ROUNDS, cipher_blocks, plain_blocks);
+        cipher_blocks += AES_BLOCK_SIZE;
+        plain_blocks += AES_BLOCK_SIZE;
+    }
+#endif
+    return 1;
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    return aes_decrypt_blocks(context, cipherBlock, plainBlock, 1);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       AES-128 with the x86 AES instruction set (AES-NI)
+ *
+ * Up to four blocks are in flight at once to hide the latency of the AESENC
+ * and AESDEC instructions.
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_NI)
+
+#ifndef __AES__
+#error "crypto_aes_ni requires compiling with -maes"
+#endif
+
+#include <wmmintrin.h>
+
+#include "aes_ni.h"
+
+#define ROUNDS          (10)    /**< rounds of AES-128 */
+#define PARALLEL        (4)     /**< number of blocks in flight */
+
+static inline __m128i _expand_step(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/* the round constant needs to be an immediate */
+#define EXPAND(rk, i, rcon) \
+    rk[i] = _expand_step(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+static void _expand_key(const uint8_t *key, __m128i rk[ROUNDS + 1])
+{
+    rk[0] = _mm_loadu_si128((const __m128i *)key);
+    EXPAND(rk, 1, 0x01);
+    EXPAND(rk, 2, 0x02);
+    EXPAND(rk, 3, 0x04);
+    EXPAND(rk, 4, 0x08);
+    EXPAND(rk, 5, 0x10);
+    EXPAND(rk, 6, 0x20);
+    EXPAND(rk, 7, 0x40);
+    EXPAND(rk, 8, 0x80);
+    EXPAND(rk, 9, 0x1b);
+    EXPAND(rk, 10, 0x36);
+}
+
+void aes_ni_encrypt_blocks(const uint8_t *key, const uint8_t *in,
+                           uint8_t *out, size_t numof)
+{
+    __m128i rk[ROUNDS + 1];
+    __m128i b[PARALLEL];
+
+    _expand_key(key, rk);
+    while (numof > 0) {
+        unsigned n = (numof < PARALLEL) ? numof : PARALLEL;
+
+        for (unsigned i = 0; i < n; i++) {
+            b[i] = _mm_loadu_si128((const __m128i *)&in[i * 16]);
+            b[i] = _mm_xor_si128(b[i], rk[0]);
+        }
+        for (unsigned r = 1; r < ROUNDS; r++) {
+            for (unsigned i = 0; i < n; i++) {
+                b[i] = _mm_aesenc_si128(b[i], rk[r]);
+            }
+        }
+        for (unsigned i = 0; i < n; i++) {
+            b[i] = _mm_aesenclast_si128(b[i], rk[ROUNDS]);
+            _mm_storeu_si128((__m128i *)&out[i * 16], b[i]);
+        }
+        in += n * 16;
+        out += n * 16;
+        numof -= n;
+    }
+}
+
+void aes_ni_decrypt_blocks(const uint8_t *key, const uint8_t *in,
+                           uint8_t *out, size_t numof)
+{
+    __m128i rk[ROUNDS + 1];
+    __m128i b[PARALLEL];
+
+    _expand_key(key, rk);
+    /* equivalent inverse cipher: reverse order, InvMixColumns on the inner
+     * round keys */
+    for (unsigned r = 1; r < ROUNDS; r++) {
+        rk[r] = _mm_aesimc_si128(rk[r]);
+    }
+    while (numof > 0) {
+        unsigned n = (numof < PARALLEL) ? numof : PARALLEL;
+
+        for (unsigned i = 0; i < n; i++) {
+            b[i] = _mm_loadu_si128((const __m128i *)&in[i * 16]);
+            b[i] = _mm_xor_si128(b[i], rk[ROUNDS]);
+        }
+        for (unsigned r = ROUNDS - 1; r > 0; r--) {
+            for (unsigned i = 0; i < n; i++) {
+                b[i] = _mm_aesdec_si128(b[i], rk[r]);
+            }
+        }
+        for (unsigned i = 0; i < n; i++) {
+            b[i] = _mm_aesdeclast_si128(b[i], rk[0]);
+            _mm_storeu_si128((__m128i *)&out[i * 16], b[i]);
+        }
+        in += n * 16;
+        out += n * 16;
+        numof -= n;
+    }
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_CRYPTO_AES_NI */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       AES-128 with the x86 AES instruction set (AES-NI)
+ *
+ * @internal
+ */
+#ifndef AES_NI_H
+#define AES_NI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Encrypt @p numof consecutive blocks with AES-128
+ *
+ * @param[in]   key     the 16 byte key
+ * @param[in]   in      @p numof plaintext blocks
+ * @param[out]  out     @p numof ciphertext blocks, may be the same as @p in
+ * @param[in]   numof   number of blocks
+ */
+void aes_ni_encrypt_blocks(const uint8_t *key, const uint8_t *in,
+                           uint8_t *out, size_t numof);
+
+/**
+ * @brief   Decrypt @p numof consecutive blocks with AES-128
+ *
+ * @param[in]   key     the 16 byte key
+ * @param[in]   in      @p numof ciphertext blocks
+ * @param[out]  out     @p numof plaintext blocks, may be the same as @p in
+ * @param[in]   numof   number of blocks
+ */
+void aes_ni_decrypt_blocks(const uint8_t *key, const uint8_t *in,
+                           uint8_t *out, size_t numof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AES_NI_H */
+/** @} */
@@ -46,6 +46,50 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
 }
 
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->encrypt_blocks) {
+        return cipher->interface->encrypt_blocks(&cipher->context, input,
+                                                 output, numof);
+    }
+    for (size_t i = 0; i < numof; i++) {
+        int res = cipher_encrypt(cipher, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += block_size;
+        output += block_size;
+    }
+    return 1;
+}
+
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->decrypt_blocks) {
+        return cipher->interface->decrypt_blocks(&cipher->context, input,
+                                                 output, numof);
+    }
+    for (size_t i = 0; i < numof; i++) {
+        int res = cipher_decrypt(cipher, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += block_size;
+        output += block_size;
+    }
+    return 1;
+}
+
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha256
+ * @{
+ *
+ * @file
+ * @brief       SHA-256 block compression with the x86 SHA extensions
+ *
+ * The state is kept in the ABEF/CDGH layout expected by SHA256RNDS2 for all
+ * blocks and converted back only at the end.
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_HASHES_SHA_NI)
+
+#if !defined(__SHA__) || !defined(__SSE4_1__)
+#error "hashes_sha_ni requires compiling with -msha -msse4.1"
+#endif
+
+#include <immintrin.h>
+
+#include "hashes/sha2xx_common.h"
+#include "sha256_ni.h"
+
+void sha256_ni_transform(uint32_t *state, const unsigned char *blocks,
+                         size_t numof)
+{
+    /* turns the big-endian message words into host order */
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i abef, cdgh, tmp;
+
+    tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    cdgh = _mm_loadu_si128((const __m128i *)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xb1);                 /* CDAB */
+    cdgh = _mm_shuffle_epi32(cdgh, 0x1b);               /* EFGH */
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);               /* ABEF */
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);            /* CDGH */
+
+    while (numof--) {
+        __m128i abef_save = abef, cdgh_save = cdgh;
+        __m128i msg[4];
+
+        for (unsigned i = 0; i < 4; i++) {
+            msg[i] = _mm_loadu_si128((const __m128i *)&blocks[16 * i]);
+            msg[i] = _mm_shuffle_epi8(msg[i], bswap);
+        }
+        /* four rounds per iteration */
+        for (unsigned j = 0; j < 16; j++) {
+            if (j >= 4) {
+                /* msg[j & 3] still holds the words of four rounds ago */
+                __m128i w = _mm_sha256msg1_epu32(msg[j & 3],
+                                                 msg[(j + 1) & 3]);
+                w = _mm_add_epi32(w, _mm_alignr_epi8(msg[(j + 3) & 3],
+                                                     msg[(j + 2) & 3], 4));
+                msg[j & 3] = _mm_sha256msg2_epu32(w, msg[(j + 3) & 3]);
+            }
+            tmp = _mm_add_epi32(msg[j & 3],
+                                _mm_loadu_si128((const __m128i *)&K[4 * j]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, tmp);
+            tmp = _mm_shuffle_epi32(tmp, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, tmp);
+        }
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+        blocks += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);                /* FEBA */
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);               /* DCHG */
+    abef = _mm_blend_epi16(tmp, cdgh, 0xf0);            /* DCBA */
+    cdgh = _mm_alignr_epi8(cdgh, tmp, 8);               /* HGFE */
+    _mm_storeu_si128((__m128i *)&state[0], abef);
+    _mm_storeu_si128((__m128i *)&state[4], cdgh);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_HASHES_SHA_NI */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha256
+ * @{
+ *
+ * @file
+ * @brief       SHA-256 block compression with the x86 SHA extensions
+ *
+ * @internal
+ */
+#ifndef SHA256_NI_H
+#define SHA256_NI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Compress @p numof consecutive blocks into @p state
+ *
+ * @param[in,out]   state   the SHA-224/SHA-256 state
+ * @param[in]       blocks  @p numof 64 byte blocks, may be unaligned
+ * @param[in]       numof   number of blocks
+ */
+void sha256_ni_transform(uint32_t *state, const unsigned char *blocks,
+                         size_t numof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHA256_NI_H */
+/** @} */
@@ -49,15 +49,16 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "kernel_defines.h"
 #include "hashes/sha2xx_common.h"
+#if IS_USED(MODULE_HASHES_SHA_NI)
+#include "sha256_ni.h"
+#endif
 
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
 #define be32enc_vect memcpy
-
-/* Copy a vector of bytes into a vector of big-endian uint32_t */
-#define be32dec_vect memcpy
 #else /* !__BIG_ENDIAN__ */
 
 /*
@@ -89,51 +90,87 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
     }
 }
 
-/*
- * Decode a big-endian length len vector of (unsigned char) into a length
- * len/4 vector of (uint32_t).  Assumes len is a multiple of 4.
- */
-#define be32dec_vect be32enc_vect
-
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#if IS_USED(MODULE_HASHES_SHA_NI)
+#define sha2xx_transform sha256_ni_transform
+#else
+/* Read a big-endian word from a possibly unaligned address */
+static inline uint32_t _load_be32(const unsigned char *src)
+{
+    return ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) |
+           ((uint32_t)src[2] << 8) | (uint32_t)src[3];
+}
+
+/* The message schedule only keeps the last 16 words */
+#define MSG(i)  (((i) < 16) ? W[i] : \
+                 (W[(i) & 15] += s1(W[((i) - 2) & 15]) + \
+                                 W[((i) - 7) & 15] + \
+                                 s0(W[((i) - 15) & 15])))
+
+/* One round, the caller rotates the working variables */
+#define RND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + K[i] + MSG(i); \
+        uint32_t t1 = S0(a) + Maj(a, b, c); \
+        d += t0; \
+        h = t0 + t1; \
+    } while (0)
+
+/* Eight rounds, after which the working variables are in place again */
+#define RNDS8(i) \
+    do { \
+        RND(a, b, c, d, e, f, g, h, (i) + 0); \
+        RND(h, a, b, c, d, e, f, g, (i) + 1); \
+        RND(g, h, a, b, c, d, e, f, (i) + 2); \
+        RND(f, g, h, a, b, c, d, e, (i) + 3); \
+        RND(e, f, g, h, a, b, c, d, (i) + 4); \
+        RND(d, e, f, g, h, a, b, c, (i) + 5); \
+        RND(c, d, e, f, g, h, a, b, (i) + 6); \
+        RND(b, c, d, e, f, g, h, a, (i) + 7); \
+    } while (0)
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
- * the 512-bit input block to produce a new state.
+ * numof consecutive 512-bit input blocks to produce a new state.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+static void sha2xx_transform(uint32_t *state, const unsigned char *block,
+                             size_t numof)
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    uint32_t W[16];
 
-    /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
+    while (numof--) {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
-
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
-    }
-
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+        for (unsigned i = 0; i < 16; i++) {
+            W[i] = _load_be32(&block[4 * i]);
+        }
+#if IS_USED(MODULE_HASHES_SHA256_UNROLL)
+        for (unsigned i = 0; i < 64; i += 8) {
+            RNDS8(i);
+        }
+#else
+        for (unsigned i = 0; i < 64; i++) {
+            RND(a, b, c, d, e, f, g, h, i);
+            uint32_t t = h;
+            h = g; g = f; f = e; e = d; d = c; c = b; b = a; a = t;
+        }
+#endif
+
+        /* Mix local working variables into global state */
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+        block += 64;
     }
 }
+#endif /* MODULE_HASHES_SHA_NI */
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -191,15 +228,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
-    /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    /* Perform complete blocks directly from the input */
+    if (len >= 64) {
+        sha2xx_transform(ctx->state, src, len / 64);
+        src += len & ~(size_t)0x3f;
+        len &= 0x3f;
     }
 
     /* Copy left over data into buffer */
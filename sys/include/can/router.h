@@ -29,6 +29,28 @@ extern "C" {
 #include "can/can.h"
 #include "can/pkt.h"
 
+#ifndef CAN_ROUTER_MASK_CLASSES
+/**
+ * Number of distinct filter masks per interface whose filters are looked up
+ * in a hash table
+ *
+ * A filter which matches a single identifier (i.e. its mask covers at least
+ * @ref CAN_SFF_MASK) is hashed if its mask is one of the first
+ * @p CAN_ROUTER_MASK_CLASSES such masks registered on the interface. All other
+ * filters are kept in a list which is walked for every received frame.
+ * Set to 0 to match every filter linearly.
+ */
+#define CAN_ROUTER_MASK_CLASSES (2U)
+#endif
+
+#ifndef CAN_ROUTER_HASH_BUCKETS
+/**
+ * Number of hash buckets shared by the hashed filters of all interfaces,
+ * must be a power of two
+ */
+#define CAN_ROUTER_HASH_BUCKETS (16U)
+#endif
+
 /**
  * @brief Initialize CAN router
  */
@@ -126,6 +126,50 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts @p numof consecutive blocks independently of each other
+ *
+ * The key is expanded only once for all blocks. With the `crypto_aes_ni`
+ * module, up to four blocks are encrypted in parallel.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain_blocks  a pointer to @p numof plaintext-blocks
+ * @param       cipher_blocks a pointer to the place where the @p numof
+ *                            ciphertext-blocks will be stored. May be the
+ *                            same as @p plain_blocks.
+ * @param       numof         number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                       size_t numof);
+
+/**
+ * @brief   decrypts @p numof consecutive blocks independently of each other
+ *
+ * The key is expanded only once for all blocks. With the `crypto_aes_ni`
+ * module, up to four blocks are decrypted in parallel.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            decryption
+ * @param       cipher_blocks a pointer to @p numof ciphertext-blocks
+ * @param       plain_blocks  a pointer to the place where the @p numof
+ *                            plaintext-blocks will be stored. May be the
+ *                            same as @p cipher_blocks.
+ * @param       numof         number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_decrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *cipher_blocks, uint8_t *plain_blocks,
+                       size_t numof);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,10 +39,13 @@ extern "C" {
  * Context sizes needed for the different ciphers.
  * Always order by number of bytes descending!!! <br><br>
  *
+ * aes_key_schedule needs 176 bytes                       <br>
  * threedes     needs 24  bytes                           <br>
  * aes          needs CIPHERS_MAX_KEY_SIZE bytes          <br>
  */
-#if defined(MODULE_CRYPTO_3DES)
+#if defined(MODULE_CRYPTO_AES_KEY_SCHEDULE)
+    #define CIPHER_MAX_CONTEXT_SIZE 176
+#elif defined(MODULE_CRYPTO_3DES)
     #define CIPHER_MAX_CONTEXT_SIZE 24
 #elif defined(MODULE_CRYPTO_AES)
     #define CIPHER_MAX_CONTEXT_SIZE CIPHERS_MAX_KEY_SIZE
@@ -65,7 +69,8 @@ extern "C" {
  * @brief   the context for cipher-operations
  */
 typedef struct {
-    uint8_t context[CIPHER_MAX_CONTEXT_SIZE];  /**< buffer for cipher operations */
+    /** buffer for cipher operations, aligned for word-wise access */
+    uint8_t context[CIPHER_MAX_CONTEXT_SIZE] __attribute__((aligned(4)));
 } cipher_context_t;
 
 
@@ -89,6 +94,16 @@ typedef struct cipher_interface_st {
     /** the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /** encrypt multiple blocks at once, NULL to encrypt them one by one */
+    int (*encrypt_blocks)(const cipher_context_t *ctx,
+                          const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                          size_t numof);
+
+    /** decrypt multiple blocks at once, NULL to decrypt them one by one */
+    int (*decrypt_blocks)(const cipher_context_t *ctx,
+                          const uint8_t *cipher_blocks, uint8_t *plain_blocks,
+                          size_t numof);
 } cipher_interface_t;
 
 
@@ -162,6 +177,42 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt multiple consecutive blocks independently of each other
+ *
+ * This is the same as calling cipher_encrypt() for each block, but lets the
+ * cipher set up the key and use hardware acceleration only once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p numof blocks to encrypt
+ * @param output     pointer to allocated memory for @p numof encrypted
+ *                   blocks. May be the same as @p input.
+ * @param numof      number of blocks
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+
+/**
+ * @brief Decrypt multiple consecutive blocks independently of each other
+ *
+ * This is the same as calling cipher_decrypt() for each block, but lets the
+ * cipher set up the key and use hardware acceleration only once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p numof blocks to decrypt
+ * @param output     pointer to allocated memory for @p numof decrypted
+ *                   blocks. May be the same as @p input.
+ * @param numof      number of blocks
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+
 /**
  * @brief Get block size of cipher
  * *
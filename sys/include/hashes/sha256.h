@@ -34,6 +34,15 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The block compression processes all complete blocks of an update in one
+ * call. It can be tuned with the following pseudomodules, which also apply to
+ * @ref sys_hashes_sha224 as it shares the compression function:
+ *
+ *  * hashes_sha256_unroll: unroll the rounds of the portable C implementation,
+ *    trading about twice the code size for higher throughput.
+ *  * hashes_sha_ni: use the SHA instructions of x86 CPUs on the `native`
+ *    board. The CPU running the binary must support them.
  * @{
  *
  * @file
@@ -90,6 +90,13 @@
  * If no payload, call only gcoap_response() to write the full response. If you
  * need to add Options, follow the first three steps in the list above instead.
  *
+ * A payload that is already kept in another buffer, e.g. a constant resource
+ * representation, does not need to be copied into the response. Instead point
+ * the _snips_ attribute of the coap_pkt_t to an iolist_t describing it and
+ * return only the metadata length. gcoap sends the listed buffers after the
+ * PDU with sock_udp_sendv(). The buffers must stay valid after the callback
+ * returns, so they should be static.
+ *
  * ### Resource list creation ###
  *
  * gcoap allows customization of the function that provides the list of registered
@@ -190,6 +197,11 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * A payload kept in another buffer can be attached as _snips_ of the coap_pkt_t
+ * after the call to coap_opt_finish(), like in a response. Send such a
+ * notification with gcoap_obs_send_pdu() and only the metadata length,
+ * gcoap_obs_send() sends the buffer alone.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -346,7 +358,12 @@
  * for a response, so the gcoap thread does not block while waiting. The user is
  * notified via the same callback, whether the message is received or the wait
  * times out. We track the response with an entry in the
- * `_coap_state.open_reqs` array.
+ * `_coap_state.open_reqs` array. Open requests are indexed by token and remote
+ * port in a hash table, and Observe registrations by resource and by client
+ * and token, so the look-up does not grow with
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX or
+ * @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX. See
+ * @ref CONFIG_GCOAP_REQ_HASH_BUCKETS and @ref CONFIG_GCOAP_OBS_HASH_BUCKETS.
  *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
@@ -456,6 +473,17 @@ extern "C" {
 #ifndef CONFIG_GCOAP_REQ_WAITING_MAX
 #define CONFIG_GCOAP_REQ_WAITING_MAX   (2)
 #endif
+
+/**
+ * @brief   Number of hash buckets to look up the request for a response
+ *
+ * Requests awaiting a response are indexed by their token and the port of
+ * the remote endpoint. Must be a power of two. Increase along with
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX to keep the look-up short.
+ */
+#ifndef CONFIG_GCOAP_REQ_HASH_BUCKETS
+#define CONFIG_GCOAP_REQ_HASH_BUCKETS  (4)
+#endif
 /** @} */
 
 /**
@@ -548,6 +576,18 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of hash buckets to look up Observe registrations
+ *
+ * Registrations are indexed by the observed resource and by client and token.
+ * Must be a power of two. Increase along with
+ * @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX to keep the look-up short.
+ */
+#ifndef CONFIG_GCOAP_OBS_HASH_BUCKETS
+#define CONFIG_GCOAP_OBS_HASH_BUCKETS  (4)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -654,7 +694,8 @@ typedef ssize_t (*gcoap_link_encoder_t)(const coap_resource_t *resource, char *b
  */
 typedef struct gcoap_listener {
     const coap_resource_t *resources;   /**< First element in the array of
-                                         *   resources; must order alphabetically */
+                                         *   resources; must be sorted by path
+                                         *   in strcmp() order */
     size_t resources_len;               /**< Length of array */
     gcoap_link_encoder_t link_encoder;  /**< Writes a link for a resource */
     struct gcoap_listener *next;        /**< Next listener in list */
@@ -881,6 +922,23 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+/**
+ * @brief   Sends a CoAP Observe notification and its payload snips to the
+ *          observer registered for a resource
+ *
+ * Like gcoap_obs_send(), but the buffers listed in coap_pkt_t::snips of @p pdu
+ * are sent after the PDU without copying them.
+ *
+ * @param[in] pdu       Notification initialized by gcoap_obs_init()
+ * @param[in] len       Length of the PDU in its buffer, without the snips
+ * @param[in] resource  Resource to send
+ *
+ * @return  length of the packet, including the snips
+ * @return  0 if cannot send
+ */
+size_t gcoap_obs_send_pdu(const coap_pkt_t *pdu, size_t len,
+                          const coap_resource_t *resource);
+
 /**
  * @brief   Provides important operational statistics
  *
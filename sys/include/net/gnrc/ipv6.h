@@ -78,6 +78,14 @@
  * destination address set to the L2 address associated to that IPv6 destination
  * address.
  *
+ * The checksum of the upper layer header is calculated at this point, with
+ * two exceptions: If the interface has
+ * @ref GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD set, UDP or TCP directly follows the
+ * IPv6 header and the packet is not fragmented, the checksum is left to the
+ * device. If the packet has a
+ * @ref gnrc_netif_hdr_t with @ref GNRC_NETIF_HDR_FLAGS_CSUM_PRESET set, the
+ * sender already calculated the checksum and it is sent as is.
+ *
  * ## `GNRC_NETAPI_MSG_TYPE_SET`
  *
  * `GNRC_NETAPI_MSG_TYPE_SET` is not supported.
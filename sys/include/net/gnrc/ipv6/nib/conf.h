@@ -214,6 +214,33 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Index off-link entries in a prefix trie for route look-up
+ *
+ * Route look-ups in the forwarding table then scale with the prefix length
+ * instead of @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF. This is useful for routers
+ * with large forwarding tables, at the cost of about
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF` trie nodes of RAM.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
+
+/**
+ * @brief   Index on-link entries in a hash table for neighbor look-up
+ *
+ * Neighbor look-ups then do not scale with @ref CONFIG_GNRC_IPV6_NIB_NUMOF
+ * anymore and free entries are handed out without searching for them. Entries
+ * that were looked up since the last time the neighbor cache was full are
+ * spared once when a garbage-collectible entry needs to be replaced, which
+ * approximates least-recently-used replacement. This is useful for routers
+ * with large neighbor caches, at the cost of two pointers per entry and
+ * @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS pointers of RAM.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH                 0
+#endif
 /** @} */
 
 /**
@@ -271,6 +298,17 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH || defined(DOXYGEN)
+/**
+ * @brief   Number of hash buckets for on-link entries in NIB
+ *
+ * @see @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS        (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#endif
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
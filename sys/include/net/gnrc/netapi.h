@@ -93,6 +93,24 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing several received
+ *          @ref net_gnrc_pkt "packets" up the network stack at once
+ *
+ * The message carries a batch: a snip of type @ref GNRC_NETTYPE_UNDEF, whose
+ * data is an array of pointers to the packets. The receiver takes over one
+ * reference to every packet and to the batch itself. Use
+ * gnrc_netapi_batch_numof() and gnrc_netapi_batch_get() to access the
+ * packets and release the batch with gnrc_pktbuf_release() after handling
+ * them.
+ *
+ * Only registry entries with gnrc_netreg_entry_t::rcv_batch set receive this
+ * message.
+ *
+ * @see gnrc_netapi_dispatch_receive_batch()
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0206)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -215,6 +233,54 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH command to all
+ *          subscribers to (@p type, @p demux_ctx).
+ *
+ * Only subscribers that opted in with gnrc_netreg_entry_t::rcv_batch get the
+ * batch. All others, including subscribers registered with a callback
+ * (@ref net_gnrc_netapi_callbacks), get one @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * message per packet instead.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] batch     batch of received packets, see
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH. All packets need
+ *                      to be of type @p type. If there are subscribers, the
+ *                      reference to @p batch is released.
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *batch);
+
+/**
+ * @brief   Gets the number of packets in a batch
+ *
+ * @param[in] batch     batch of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ *
+ * @return  Number of packets in @p batch
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet of a batch
+ *
+ * @param[in] batch     batch of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ * @param[in] idx       index of the packet, must be lesser than
+ *                      gnrc_netapi_batch_numof()
+ *
+ * @return  The packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
@@ -14,6 +14,43 @@
  * Network interfaces in the context of GNRC are threads for protocols that are
  * below the network layer.
  *
+ * Batched reception
+ * -----------------
+ *
+ * By default every received packet is passed to the upper layer with its own
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message. With the `gnrc_netif_rx_batch`
+ * module, the interface thread first handles all device interrupts that queued
+ * up (at most @ref CONFIG_GNRC_NETIF_RX_BATCH_SIZE) and passes the packets
+ * received meanwhile with a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message,
+ * which saves message queue slots and context switches during bursts.
+ *
+ * Only threads that set gnrc_netreg_entry_t::rcv_batch when registering get
+ * the batch, as @ref net_gnrc_ipv6 and @ref net_gnrc_sixlowpan do. All other
+ * subscribers still get a @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet.
+ *
+ * The `rx_count` and `rx_dispatch_count` fields of the interface's
+ * @ref netstats_t show how many packets share a message on average.
+ *
+ * Prioritized transmission
+ * ------------------------
+ *
+ * By default packets are sent in the order their @ref GNRC_NETAPI_MSG_TYPE_SND
+ * messages arrive. With the `gnrc_netif_tx_sched` module, the interface thread
+ * first moves the queued up send requests into a queue of at most
+ * @ref CONFIG_GNRC_NETIF_TX_QUEUE_SIZE packets ordered by traffic class and
+ * sends from it whenever no other message is waiting. The class is the DSCP of
+ * the IPv6 header (also when compressed with 6LoWPAN IPHC). ICMPv6 without a
+ * DSCP, i.e. NDP and RPL control messages, is treated as network control
+ * (CS6), so it is not stuck behind bulk data. Packets of the same class keep
+ * their order; fragments and other packets without a readable IPv6 header are
+ * best effort. When the queue is full, further send requests wait in the
+ * message queue of the interface in their order of arrival, so no packet is
+ * dropped by the scheduler.
+ *
+ * With @ref CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US the pause after a send
+ * ends with a timer message instead of putting the thread to sleep, so
+ * received packets and options are handled meanwhile.
+ *
  * @{
  *
  * @file
@@ -54,6 +91,12 @@
 #if IS_USED(MODULE_GNRC_NETIF_MAC)
 #include "net/gnrc/netif/mac.h"
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+#include "net/gnrc/priority_pktqueue.h"
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+#include "xtimer.h"
+#endif
+#endif
 #include "net/ndp.h"
 #include "net/netdev.h"
 #include "net/netopt.h"
@@ -140,6 +183,40 @@ typedef struct {
      */
     event_t event_isr;
 #endif /* MODULE_GNRC_NETIF_EVENTS */
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not yet passed to the upper layer
+     *
+     * @note    Only available with module `gnrc_netif_rx_batch`.
+     */
+    gnrc_pktsnip_t *rx_batch[CONFIG_GNRC_NETIF_RX_BATCH_SIZE];
+    uint8_t rx_batch_numof;                 /**< Number of packets in gnrc_netif_t::rx_batch */
+#endif /* MODULE_GNRC_NETIF_RX_BATCH */
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED) || defined(DOXYGEN)
+    /**
+     * @brief   Packets waiting to be sent, ordered by traffic class
+     *
+     * @note    Only available with module `gnrc_netif_tx_sched`.
+     */
+    gnrc_priority_pktqueue_t tx_queue;
+    /**
+     * @brief   Node pool for gnrc_netif_t::tx_queue
+     *
+     * @note    Only available with module `gnrc_netif_tx_sched`.
+     */
+    gnrc_priority_pktqueue_node_t tx_queue_nodes[CONFIG_GNRC_NETIF_TX_QUEUE_SIZE];
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U) || defined(DOXYGEN)
+    /**
+     * @brief   Timer ending the pause after a send
+     *
+     * @note    Only available with module `gnrc_netif_tx_sched` and
+     *          @ref CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0
+     */
+    xtimer_t tx_pacing_timer;
+    msg_t tx_pacing_msg;                    /**< Message of gnrc_netif_t::tx_pacing_timer */
+    bool tx_paced;                          /**< Sending is paused until the timer fires */
+#endif
+#endif /* MODULE_GNRC_NETIF_TX_SCHED */
 #if (GNRC_NETIF_L2ADDR_MAXLEN > 0) || DOXYGEN
     /**
      * @brief   The link-layer address currently used as the source address
@@ -152,10 +152,50 @@ extern "C" {
  * @experimental
  *
  * This is purely meant as a debugging feature to slow down a radios sending.
+ * With the `gnrc_netif_tx_sched` module the interface keeps handling messages
+ * during this time instead of sleeping, unless its send queue overflows (see
+ * @ref CONFIG_GNRC_NETIF_TX_QUEUE_SIZE).
  */
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Maximum number of received packets handed to the upper layer in one
+ *          go
+ *
+ * Only used with the `gnrc_netif_rx_batch` module. The network interface
+ * handles up to this many pending device interrupts before it passes the
+ * packets received meanwhile to the upper layer with a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message.
+ *
+ * @attention   Every network interface holds an array of this many packet
+ *              pointers.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_RX_BATCH_SIZE            (8U)
+#endif
+
+/**
+ * @brief   Maximum number of packets waiting to be sent
+ *
+ * Only used with the `gnrc_netif_tx_sched` module. Packets to send are queued
+ * by traffic class, so packets with a higher DSCP overtake bulk traffic that
+ * is still waiting. When the queue is full, further requests wait in the
+ * message queue of the interface, so a larger queue only widens the window
+ * in which packets are reordered.
+ *
+ * @note    A request the interface already took from its message queue while
+ *          the send queue is full makes room by sending the packet with the
+ *          highest priority. If @ref CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
+ *          did not pass since the previous transmission, the interface
+ *          thread sleeps for that time first and handles no other messages
+ *          meanwhile. Make the queue large enough for the expected bursts to
+ *          avoid this.
+ */
+#ifndef CONFIG_GNRC_NETIF_TX_QUEUE_SIZE
+#define CONFIG_GNRC_NETIF_TX_QUEUE_SIZE            (4U)
+#endif
 /** @} */
 
 /**
@@ -139,6 +139,20 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   Device checks the transport layer checksum of received packets
+ *
+ * @see @ref NETOPT_RX_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD           (0x00020000U)
+
+/**
+ * @brief   Device inserts the transport layer checksum of sent packets
+ *
+ * @see @ref NETOPT_TX_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD           (0x00040000U)
 /** @} */
 
 #ifdef __cplusplus
@@ -22,6 +22,7 @@
 #define NET_GNRC_NETIF_HDR_H
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -88,6 +89,27 @@ extern "C" {
  *          @ref IEEE802154_FCF_FRAME_PEND
  */
 #define GNRC_NETIF_HDR_FLAGS_MORE_DATA  (0x10)
+
+/**
+ * @brief   Transport layer checksum was already checked
+ *
+ * @details This flag is set on received packets by interfaces with
+ *          @ref GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD, if UDP or TCP directly
+ *          follows the IPv6 header. UDP and TCP then skip verifying the
+ *          checksum of the packet.
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_VALID (0x08)
+
+/**
+ * @brief   Transport layer checksum was calculated by the sender
+ *
+ * @details A sender sets this flag on a packet to be sent, if it already
+ *          calculated the UDP checksum over the addresses in the IPv6
+ *          header. @ref net_gnrc_ipv6 then keeps the checksum instead of
+ *          calculating it again. The flag is not passed on to the link
+ *          layer.
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_PRESET (0x04)
 /**
  * @}
  */
@@ -324,6 +346,21 @@ void gnrc_netif_hdr_print(gnrc_netif_hdr_t *hdr);
  */
 uint8_t gnrc_netif_hdr_get_flag(gnrc_pktsnip_t* pkt);
 
+/**
+ * @brief   Check if the interface already checked the transport layer
+ *          checksum of a received gnrc packet
+ *
+ * @note    With module `netstats_ipv6` a positive result is counted in
+ *          the IPv6 statistics of the receiving interface.
+ *
+ * @param[in]   pkt     gnrc packet to check
+ *
+ * @return              true, if @ref GNRC_NETIF_HDR_FLAGS_CSUM_VALID is set
+ *                      in the netif header of @p pkt
+ * @return              false, otherwise or if no header is present
+ */
+bool gnrc_netif_hdr_rx_csum_offloaded(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief   Extract the destination address out of a gnrc packet
  *
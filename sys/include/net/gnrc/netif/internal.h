@@ -40,6 +40,14 @@ extern "C" {
  */
 #define NETDEV_MSG_TYPE_EVENT   (0x1234)
 
+/**
+ * @brief   Message type to end the pause after a send
+ *
+ * Only used with the `gnrc_netif_tx_sched` module and
+ * @ref CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0.
+ */
+#define GNRC_NETIF_TX_SCHED_MSG_TYPE    (0x1235)
+
 /**
  * @brief   Acquires exclusive access to the interface
  *
@@ -134,6 +134,14 @@ typedef struct {
      *          @ref CONFIG_GNRC_IPV6_NIB_ROUTER != 0
      */
     evtimer_msg_event_t snd_mc_ra;
+    /**
+     * @brief   Time in milliseconds @ref gnrc_netif_ipv6_t::snd_mc_ra fires
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
+     *          and @ref net_gnrc_ipv6_nib "NIB" and if
+     *          @ref CONFIG_GNRC_IPV6_NIB_ROUTER != 0
+     */
+    uint32_t snd_mc_ra_until;
 #endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) || DOXYGEN
     /**
@@ -152,6 +160,13 @@ typedef struct {
      *          and @ref net_gnrc_ipv6_nib "NIB"
      */
     evtimer_msg_event_t search_rtr;
+    /**
+     * @brief   Time in milliseconds @ref gnrc_netif_ipv6_t::search_rtr fires
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
+     *          and @ref net_gnrc_ipv6_nib "NIB"
+     */
+    uint32_t search_rtr_until;
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN) || IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_SLAAC) || DOXYGEN
     /**
      * @brief   Timers for address re-registration
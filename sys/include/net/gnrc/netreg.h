@@ -17,11 +17,35 @@
  *          @ref net_gnrc_netapi.
  *
  * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
+ *
+ * @defgroup    net_gnrc_netreg_hash  Hashed network protocol registry
+ * @ingroup     net_gnrc_netreg
+ * @brief       Hash table to find the entries of the @ref net_gnrc_netreg
+ * @{
+ *
+ * By default, the entries of the registry are kept in a list per protocol
+ * type, which has to be searched for the demultiplexing context on every
+ * look-up. With many registrations of one type, e.g. a lot of UDP sockets,
+ * this becomes the dominant cost of passing a packet up the stack.
+ *
+ * The submodule `gnrc_netreg_hash` keeps the entries in a hash table keyed by
+ * protocol type and demultiplexing context instead, so the look-up only
+ * searches the entries sharing a bucket. The order of entries with the same
+ * type and context, as returned by gnrc_netreg_getnext(), stays the same.
+ *
+ * To use, add the module `gnrc_netreg_hash` to the `USEMODULE` macro in your
+ * application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netreg_hash
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 #ifndef NET_GNRC_NETREG_H
 #define NET_GNRC_NETREG_H
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 #include "kernel_types.h"
 #include "net/gnrc/nettype.h"
@@ -79,6 +103,15 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of buckets of the hash table (as exponent of 2^n)
+ *
+ * @note    Only used with @ref net_gnrc_netreg_hash.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP (4U)
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -87,25 +120,28 @@ typedef enum {
 /**
  * @brief   Initializes a netreg entry statically with PID
  *
- * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ * @param[in] _demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
  *                      for the netreg entry
- * @param[in] pid       The PID of the registering thread
+ * @param[in] _pid      The PID of the registering thread
  *
  * @return  An initialized netreg entry
  */
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
-                                                      GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(_demux_ctx, _pid) { .next = NULL, \
+                                                      .demux_ctx = _demux_ctx, \
+                                                      .type = GNRC_NETREG_TYPE_DEFAULT, \
+                                                      .target = { .pid = _pid } }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(_demux_ctx, _pid) { .next = NULL, \
+                                                      .demux_ctx = _demux_ctx, \
+                                                      .target = { .pid = _pid } }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with mbox
  *
- * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ * @param[in] _demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
  *                      for the netreg entry
  * @param[in] _mbox      Target @ref core_mbox "mailbox" for the registry entry
  *
@@ -113,16 +149,17 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
-                                                       GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+#define GNRC_NETREG_ENTRY_INIT_MBOX(_demux_ctx, _mbox) { .next = NULL, \
+                                                       .demux_ctx = _demux_ctx, \
+                                                       .type = GNRC_NETREG_TYPE_MBOX, \
+                                                       .target = { .mbox = _mbox } }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with callback
  *
- * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ * @param[in] _demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
  *                      for the netreg entry
  * @param[in] _cbd       Target callback for the registry entry
  *
@@ -130,9 +167,10 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
-                                                      GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+#define GNRC_NETREG_ENTRY_INIT_CB(_demux_ctx, _cbd)  { .next = NULL, \
+                                                      .demux_ctx = _demux_ctx, \
+                                                      .type = GNRC_NETREG_TYPE_CB, \
+                                                      .target = { .cbd = _cbd } }
 /** @} */
 
 /**
@@ -210,6 +248,29 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Receive packets passed on together in a single
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+     *
+     * Set this before registering the entry if the target handles such
+     * messages. Otherwise, every packet of a batch is delivered with its own
+     * @ref GNRC_NETAPI_MSG_TYPE_RCV message. Ignored for callbacks.
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    bool rcv_batch;
+#endif
+#if defined(MODULE_GNRC_NETREG_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Protocol type the entry is registered for
+     *
+     * @note    Only available with @ref net_gnrc_netreg_hash.
+     *
+     * @internal
+     */
+    gnrc_nettype_t nettype;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -241,6 +302,9 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    entry->rcv_batch = false;
+#endif
 }
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -262,6 +326,9 @@ static inline void gnrc_netreg_entry_init_mbox(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_MBOX;
     entry->target.mbox = mbox;
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    entry->rcv_batch = false;
+#endif
 }
 #endif
 
@@ -284,6 +351,9 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_CB;
     entry->target.cbd = cbd;
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    entry->rcv_batch = false;
+#endif
 }
 #endif
 /** @} */
@@ -62,6 +62,69 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @name    Size classes of the `gnrc_pktbuf_slab` packet buffer
+ *
+ * `gnrc_pktbuf_slab` keeps one pool of fixed-size blocks per size class
+ * instead of a single first-fit arena, so allocating and freeing is O(1) and
+ * the buffer can not fragment into unusable holes. An allocation is served
+ * from the smallest class with a free block that can hold it.
+ * @{
+ */
+/**
+ * @brief   Number of blocks for packet snip descriptors (`gnrc_pktsnip_t`)
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF  (32U)
+#endif
+
+/**
+ * @brief   Size of blocks for protocol headers (e.g. IPv6, UDP, 6LoWPAN,
+ *          `gnrc_netif_hdr_t`)
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE    (64U)
+#endif
+
+/**
+ * @brief   Number of blocks for protocol headers
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF   (32U)
+#endif
+
+/**
+ * @brief   Size of blocks for small payloads and link-layer frames
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE  (256U)
+#endif
+
+/**
+ * @brief   Number of blocks for small payloads and link-layer frames
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF (8U)
+#endif
+
+/**
+ * @brief   Size of blocks for MTU-sized payloads
+ *
+ * This is also the largest packet snip the packet buffer can hold. The default
+ * fits a full Ethernet frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE    (1536U)
+#endif
+
+/**
+ * @brief   Number of blocks for MTU-sized payloads
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF   (4U)
+#endif
+/** @} */
 /** @} */
 
 /**
@@ -76,6 +76,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE       (4U)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up reassembly buffer entries
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Reassembly buffer entries are found by hashing the (source, destination,
+ * tag) tuple of a fragment. Must be a power of 2. Should be in the order of
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE to keep the look-up chains short.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS   (4U)
+#endif
+
 /**
  * @brief   Timeout for reassembly buffer entries in microseconds
  *
@@ -39,6 +39,9 @@ extern "C" {
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
+ * The intervals of a reassembly buffer entry are sorted by their start and
+ * intervals of adjacent fragments are merged into one.
+ *
  * @note    Fragments MUST NOT overlap and overlapping fragments are to be
  *          discarded
  *
@@ -82,6 +85,16 @@ typedef struct {
     uint16_t current_size;
     uint32_t arrival;                           /**< time in microseconds of arrival of
                                                  *   last received fragment */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || defined(DOXYGEN)
+    /**
+     * @brief   Number of fragments received for the datagram
+     *
+     * @note    Only available with the `gnrc_sixlowpan_frag_stats` module.
+     *          Adjacent intervals in gnrc_sixlowpan_frag_rb_base_t::ints are
+     *          merged, so they can't be used to count the fragments.
+     */
+    uint16_t fragments;
+#endif
 } gnrc_sixlowpan_frag_rb_base_t;
 
 /**
@@ -37,6 +37,9 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    unsigned rbuf_lookups;  /**< look-ups of reassembly buffer entries */
+    unsigned rbuf_lookup_depth; /**< total number of entries compared in all
+                                 *   look-ups of reassembly buffer entries */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
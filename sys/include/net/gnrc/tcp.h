@@ -11,6 +11,12 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * A connection keeps up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+ * segments in flight. Lost segments are retransmitted after three duplicate
+ * ACKs without waiting for the retransmission timeout (RFC 5681). With the
+ * `gnrc_tcp_sack` module, selective acknowledgments (RFC 2018) are negotiated
+ * and segments the peer already received are not retransmitted.
+ *
  * @{
  *
  * @file
@@ -162,6 +168,9 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE segments are in flight
+ *       at a time, the function returns once all transmitted bytes were
+ *       acknowledged by the peer.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -171,6 +180,9 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  *                                           If zero, no timeout will be triggered.
  *
  * @return   The number of successfully transmitted bytes.
+ * @return   The number of bytes acknowledged by the peer, if the connection was
+ *           aborted or @p user_timeout_duration_us expired after part of the
+ *           data was acknowledged.
  * @return   -ENOTCONN if connection is not established.
  * @return   -ECONNRESET if connection was reset by the peer.
  * @return   -ECONNABORTED if the connection was aborted.
@@ -167,6 +167,19 @@ extern "C" {
 #ifndef CONFIG_GNRC_TCP_PROBE_UPPER_BOUND
 #define CONFIG_GNRC_TCP_PROBE_UPPER_BOUND (60U * US_PER_SEC)
 #endif
+
+/**
+ * @brief Maximum number of unacknowledged segments per connection.
+ *
+ * Every segment in flight is kept in the packet buffer until it is
+ * acknowledged, so increase the packet buffer size
+ * (@ref CONFIG_GNRC_PKTBUF_SIZE) accordingly. The default of one segment
+ * limits a connection to one MSS per round trip time. At least four segments
+ * are needed for fast retransmission to take effect. Must be between 1 and 8.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
 /** @} */
 
 #ifdef __cplusplus
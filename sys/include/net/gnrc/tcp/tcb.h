@@ -90,7 +90,13 @@ typedef struct _transmission_control_block {
     uint8_t retries;       /**< Number of retransmissions */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    uint32_t rtt_seq;      /**< AckNo. that completes the rtt measurement */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE]; /**< Retransmit queue,
+                                                                                ordered by SeqNo. */
+    uint8_t pkt_retransmit_numof;   /**< Number of packets in the retransmit queue */
+    uint8_t pkt_sacked;    /**< Bitmap of selectively acknowledged packets in the
+                                retransmit queue */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
@@ -49,6 +49,24 @@ extern "C" {
  */
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len);
 
+/**
+ * @brief   Reference implementation of inet_csum_slice(), summing up the
+ *          buffer byte by byte
+ *
+ * inet_csum_slice() accumulates machine words and must yield the same
+ * results. This function is only meant for testing and benchmarking.
+ *
+ * @param[in] sum       An initial value for the checksum.
+ * @param[in] buf       A buffer.
+ * @param[in] len       Length of @p buf in byte.
+ * @param[in] accum_len Accumulated length of checksum domain that has already
+ *                      been checksummed.
+ *
+ * @return  The unnormalized Internet Checksum of @p buf.
+ */
+uint16_t inet_csum_slice_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                  size_t accum_len);
+
 /**
  * @brief   Calculates the unnormalized Internet Checksum of @p buf, where the
  *          buffer provides a standalone domain for the checksum.
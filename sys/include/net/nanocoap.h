@@ -64,6 +64,11 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * The resources must be sorted by their path in strcmp() order, i.e. by the
+ * ASCII encoding of the path characters, as they are looked up with a binary
+ * search (see coap_find_resource()). If several resources match a request,
+ * the first one in the array wins.
+ *
  * @{
  *
  * @file
@@ -189,6 +194,11 @@ typedef struct {
     uint16_t payload_len;                             /**< length of payload       */
     uint16_t options_len;                             /**< length of options array */
     coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
+    struct iolist *snips;                             /**< payload snips sent after
+                                                           the PDU (optional),
+                                                           set to NULL by
+                                                           coap_pkt_init() and
+                                                           coap_parse() */
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
 #endif
@@ -1521,13 +1531,14 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
 /**
  * @brief   Pass a coap request to a matching handler
  *
- * This function will try to find a matching handler in @p resources and call
- * the handler.
+ * This function will try to find a matching handler in @p resources with
+ * coap_find_resource() and call the handler.
  *
  * @param[in]   pkt             pointer to (parsed) CoAP packet
  * @param[out]  resp_buf        buffer for response
  * @param[in]   resp_buf_len    size of response buffer
- * @param[in]   resources       Array of coap endpoint resources
+ * @param[in]   resources       Array of coap endpoint resources, sorted by
+ *                              path
  * @param[in]   resources_numof length of the coap endpoint resources
  *
  * @returns     size of the reply packet on success
@@ -1538,6 +1549,34 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
                           const coap_resource_t *resources,
                           size_t resources_numof);
 
+/**
+ * @brief   Finds the resource to handle a request for a given URI path
+ *
+ * The resources are looked up with a binary search, so @p resources must be
+ * sorted by coap_resource_t::path in strcmp() order. The result is the same
+ * as of a linear search over the resources: the first resource in
+ * @p resources, whose path either equals @p uri or, with
+ * @ref COAP_MATCH_SUBTREE, is a prefix of @p uri, and that allows the
+ * requested method.
+ *
+ * @param[in]   resources       sorted array of resources
+ * @param[in]   resources_numof number of entries in @p resources
+ * @param[in]   uri             null-terminated URI path of the request
+ * @param[in]   method_flag     flag of the requested method, see
+ *                              coap_method2flag()
+ * @param[out]  path_found      set to true, if a resource matched @p uri, but
+ *                              did not allow the requested method. Left
+ *                              unchanged otherwise. May be NULL.
+ *
+ * @return  the matching resource
+ * @return  NULL, if no resource matches @p uri and @p method_flag
+ */
+const coap_resource_t *coap_find_resource(const coap_resource_t *resources,
+                                          size_t resources_numof,
+                                          const uint8_t *uri,
+                                          coap_method_flags_t method_flag,
+                                          bool *path_found);
+
 /**
  * @brief   Convert message code (request method) into a corresponding bit field
  *
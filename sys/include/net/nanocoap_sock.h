@@ -170,6 +170,11 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf,
 /**
  * @brief   Simple synchronous CoAP request
  *
+ * If coap_pkt_t::snips of @p pkt is not NULL, the buffers it points to are
+ * sent as payload after the PDU without copying them into the request buffer
+ * first. The PDU must then end with the payload marker. Packets that are not
+ * set up by coap_pkt_init() or coap_parse() must initialize the member to NULL.
+ *
  * @param[in,out]   pkt     Packet struct containing the request. Is reused for
  *                          the response
  * @param[in]       local   Local UDP endpoint, may be NULL
@@ -183,6 +188,66 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf,
 ssize_t nanocoap_request(coap_pkt_t *pkt, sock_udp_ep_t *local,
                          sock_udp_ep_t *remote, size_t len);
 
+/**
+ * @brief   Block-wise transfer size (SZX)
+ */
+typedef enum {
+    COAP_BLOCKSIZE_32 = 1,
+    COAP_BLOCKSIZE_64,
+    COAP_BLOCKSIZE_128,
+    COAP_BLOCKSIZE_256,
+    COAP_BLOCKSIZE_512,
+    COAP_BLOCKSIZE_1024,
+} coap_blksize_t;
+
+/**
+ * @brief   Block-wise request callback
+ *
+ * @param[in] arg      Pointer to be passed as arguments to the callback
+ * @param[in] offset   Offset of received data
+ * @param[in] buf      Pointer to the received data
+ * @param[in] len      Length of the received data
+ * @param[in] more     -1 for no option, 0 for last block, 1 for more blocks
+ *
+ * @returns    0       on success
+ * @returns   -1       on error
+ */
+typedef int (*coap_blockwise_cb_t)(void *arg, size_t offset, uint8_t *buf,
+                                   size_t len, int more);
+
+/**
+ * @brief   Block-wise CoAP (confirmable) get
+ *
+ * Fetches the resource at @p path block by block (Block2, RFC 7959), keeping
+ * requests for up to @p window consecutive blocks outstanding. Responses that
+ * arrive out of order are buffered, @p callback is always called in order of
+ * the offset. Each request is retransmitted on its own.
+ *
+ * With a @p window of 1, this is a plain sequential transfer. Larger windows
+ * hide the round-trip time on multi-hop paths, but exceed the limit of one
+ * outstanding interaction per server (NSTART) of RFC 7252. Use them only
+ * with servers and networks known to cope with it.
+ *
+ * The function needs `window * 2^(blksize + 4)` bytes of stack for buffering
+ * on top of one block sized receive buffer.
+ *
+ * @note    Requires the `nanocoap_sock_blockwise` module.
+ *
+ * @param[in]   remote      remote UDP endpoint
+ * @param[in]   path        remote path
+ * @param[in]   blksize     block size to request
+ * @param[in]   window      number of blocks to request concurrently, >= 1
+ * @param[in]   callback    callback to be executed on each received block
+ * @param[in]   arg         optional function arguments
+ *
+ * @returns     0 on success
+ * @returns     -1 if the server reported an error or @p callback failed
+ * @returns     <0 on other errors, e.g. -ETIMEDOUT
+ */
+int nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                           coap_blksize_t blksize, unsigned window,
+                           coap_blockwise_cb_t callback, void *arg);
+
 #ifdef __cplusplus
 }
 #endif
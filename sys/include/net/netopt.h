@@ -730,6 +730,31 @@ typedef enum {
      */
     NETOPT_LINK_CHECK,
 
+    /**
+     * @brief   (@ref netopt_enable_t) Device checks the UDP and TCP checksum
+     *          of received frames
+     *
+     * When enabled, the device only passes up frames with a valid transport
+     * layer checksum, so the network stack does not need to verify it again.
+     * This only covers UDP and TCP directly following the IPv6 header, the
+     * stack still checks fragments and packets with extension headers. A
+     * device that cannot check every such frame (e.g. because it passes on
+     * frames it did not verify) must not claim this option. Usually
+     * read-only.
+     */
+    NETOPT_RX_CSUM_OFFLOAD,
+
+    /**
+     * @brief   (@ref netopt_enable_t) Device inserts the UDP and TCP checksum
+     *          of sent frames
+     *
+     * When enabled, the device calculates the transport layer checksum,
+     * including the IPv6 pseudo-header, of every unfragmented UDP and TCP
+     * frame it sends. The network stack then leaves the checksum field
+     * alone. Usually read-only.
+     */
+    NETOPT_TX_CSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
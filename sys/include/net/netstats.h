@@ -51,6 +51,12 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+    uint32_t rx_dispatch_count; /**< messages used to pass received packets
+                                     to the upper layer */
+    uint32_t rx_csum_offload_count; /**< received packets whose transport
+                                         checksum the device checked */
+    uint32_t tx_csum_offload_count; /**< sent packets whose transport
+                                         checksum the device inserted */
 } netstats_t;
 
 #ifdef __cplusplus
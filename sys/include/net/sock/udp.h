@@ -281,6 +281,7 @@
 #endif
 
 #include "net/sock.h"
+#include "iolist.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -494,6 +495,40 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Sends a UDP message composed of several buffers to remote end point
+ *
+ * The buffers are sent as one UDP message in the order of @p snips. This
+ * allows e.g. to send a protocol header and a payload kept in different
+ * places without copying them into a common buffer first:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * iolist_t payload = { .iol_base = data, .iol_len = data_len };
+ * iolist_t head = { .iol_next = &payload, .iol_base = hdr,
+ *                   .iol_len = hdr_len };
+ *
+ * res = sock_udp_sendv(&sock, &head, &remote);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre `((sock != NULL || remote != NULL))`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] snips     List of buffers to send. May be `NULL` to send an
+ *                      empty message.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  The same errors as sock_udp_send().
+ */
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
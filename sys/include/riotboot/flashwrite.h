@@ -41,6 +41,19 @@
  * 2. write image starting at second block
  * 3. write first block
  *
+ * If the platform provides `periph_flashpage_raw`, data is written to flash
+ * as soon as a complete write block (@ref FLASHPAGE_RAW_BLOCKSIZE) has been
+ * received, instead of waiting for a full page. Each page is erased ahead,
+ * right after the previous page has been completed. This way, the time spent
+ * writing flash is spread evenly over the incoming data, instead of stalling
+ * the transport once per page.
+ *
+ * With `riotboot_flashwrite_verify_sha256`, the SHA-256 digest of the image is
+ * computed while the data streams in. @ref riotboot_flashwrite_verify_sha256_stream()
+ * checks it without reading back the slot. As every chunk is verified after
+ * writing it to flash, the result is the same as that of
+ * @ref riotboot_flashwrite_verify_sha256().
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  *
@@ -54,8 +67,21 @@
 extern "C" {
 #endif
 
+#include "kernel_defines.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+#include "hashes/sha256.h"
+#endif
+
+/**
+ * @brief   Alignment of the flash writing buffer
+ */
+#if IS_USED(MODULE_PERIPH_FLASHPAGE_RAW) || defined(DOXYGEN)
+#define RIOTBOOT_FLASHWRITE_ALIGNMENT   (FLASHPAGE_RAW_ALIGNMENT)
+#else
+#define RIOTBOOT_FLASHWRITE_ALIGNMENT   (1)
+#endif
 
 /**
  * @brief   firmware update state structure
@@ -67,7 +93,16 @@ typedef struct {
     int target_slot;                        /**< update targets this slot     */
     size_t offset;                          /**< update is at this position   */
     unsigned flashpage;                     /**< update is at this flashpage  */
-    uint8_t flashpage_buf[FLASHPAGE_SIZE];  /**< flash writing buffer         */
+#if IS_USED(MODULE_PERIPH_FLASHPAGE_RAW) || defined(DOXYGEN)
+    size_t flashpage_written;               /**< bytes of the current page
+                                                 already written to flash     */
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256) || defined(DOXYGEN)
+    sha256_context_t sha256;                /**< digest of the data so far    */
+#endif
+    /** flash writing buffer */
+    uint8_t flashpage_buf[FLASHPAGE_SIZE]
+        __attribute__((aligned(RIOTBOOT_FLASHWRITE_ALIGNMENT)));
 } riotboot_flashwrite_t;
 
 /**
@@ -101,7 +136,8 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
  * number ("RIOT") by calling @ref riotboot_flashwrite_init_raw() with an
  * offset of RIOTBOOT_FLASHWRITE_SKIPLEN (4). This ensures that riotboot will
  * ignore the slot until the magic number has been restored, e.g., through @ref
- * riotboot_flashwrite_finish().
+ * riotboot_flashwrite_finish(). The magic number is accounted for in the
+ * digest computed by `riotboot_flashwrite_verify_sha256`.
  *
  * @param[in,out]   state       ptr to preallocated state structure
  * @param[in]       target_slot slot to write update into
@@ -112,8 +148,14 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
                                            int target_slot)
 {
     /* initialize state, but skip "RIOT" */
-    return riotboot_flashwrite_init_raw(state, target_slot,
-                                        RIOTBOOT_FLASHWRITE_SKIPLEN);
+    int res = riotboot_flashwrite_init_raw(state, target_slot,
+                                           RIOTBOOT_FLASHWRITE_SKIPLEN);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    /* the magic number will be written by riotboot_flashwrite_finish() */
+    sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+#endif
+    return res;
 }
 
 /**
@@ -186,6 +228,26 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Verify the digest of an image while it is being written
+ *
+ * Instead of reading back the slot like @ref riotboot_flashwrite_verify_sha256(),
+ * this uses the digest computed over the data passed to
+ * @ref riotboot_flashwrite_putbytes(). The update must have been initialized
+ * via @ref riotboot_flashwrite_init().
+ *
+ * @param[in]   sha256_digest   content of the image digest
+ * @param[in]   img_size        the size of the image
+ * @param[in]   state           ptr to the state of the update
+ *
+ * @returns     -1 when the size of the written image is not @p img_size
+ * @returns     0 if the digest is valid
+ * @returns     1 if the digest is invalid
+ */
+int riotboot_flashwrite_verify_sha256_stream(const uint8_t *sha256_digest,
+                                             size_t img_size,
+                                             const riotboot_flashwrite_t *state);
+
 #ifdef __cplusplus
 }
 #endif
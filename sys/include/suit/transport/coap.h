@@ -26,11 +26,26 @@
 #define SUIT_TRANSPORT_COAP_H
 
 #include "net/nanocoap.h"
+#include "net/nanocoap_sock.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of blocks requested concurrently when fetching a manifest
+ *          or an image
+ *
+ * The default of 1 fetches one block per round-trip, as mandated by the
+ * default NSTART of RFC 7252. Over multi-hop paths with a server that copes
+ * with several outstanding requests, a larger window shortens the update
+ * considerably. Each additional block costs 64 bytes of stack of the SUIT
+ * thread.
+ */
+#ifndef CONFIG_SUIT_COAP_BLOCKWISE_WINDOW
+#define CONFIG_SUIT_COAP_BLOCKWISE_WINDOW   (1U)
+#endif
+
 /**
  * @brief    Start SUIT CoAP thread
  */
@@ -90,43 +105,18 @@ typedef const struct {
     const size_t resources_numof;       /**< nr of entries in array */
 } coap_resource_subtree_t;
 
-/**
- * @brief   Coap blockwise request callback descriptor
- *
- * @param[in] arg      Pointer to be passed as arguments to the callback
- * @param[in] offset   Offset of received data
- * @param[in] buf      Pointer to the received data
- * @param[in] len      Length of the received data
- * @param[in] more     -1 for no option, 0 for last block, 1 for more blocks
- *
- * @returns    0       on success
- * @returns   -1       on error
- */
-typedef int (*coap_blockwise_cb_t)(void *arg, size_t offset, uint8_t *buf, size_t len, int more);
-
 /**
  * @brief   Reference to the coap resource subtree
  */
 extern const coap_resource_subtree_t coap_resource_subtree_suit;
 
-/**
- * @brief Coap block-wise-transfer size SZX
- */
-typedef enum {
-    COAP_BLOCKSIZE_32 = 1,
-    COAP_BLOCKSIZE_64,
-    COAP_BLOCKSIZE_128,
-    COAP_BLOCKSIZE_256,
-    COAP_BLOCKSIZE_512,
-    COAP_BLOCKSIZE_1024,
-} coap_blksize_t;
-
 /**
  * @brief    Performs a blockwise coap get request to the specified url.
  *
  * This function will fetch the content of the specified resource path via
  * block-wise-transfer. A coap_blockwise_cb_t will be called on each received
- * block.
+ * block. @ref CONFIG_SUIT_COAP_BLOCKWISE_WINDOW blocks are requested
+ * concurrently, see @ref nanocoap_get_blockwise().
  *
  * @param[in]   url        url pointer to source path
  * @param[in]   blksize    sender suggested SZX for the COAP block request
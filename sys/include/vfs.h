@@ -86,6 +86,16 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef VFS_MOUNT_HASH_BUCKETS
+/**
+ * @brief Number of buckets of the index used to look up mount points
+ *
+ * Looking up the mount point of a path takes one look-up in this index per
+ * path component, independent of the number of mounts. Must be a power of 2.
+ */
+#define VFS_MOUNT_HASH_BUCKETS (8U)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -192,6 +202,7 @@ typedef struct {
  */
 struct vfs_mount_struct {
     clist_node_t list_entry;     /**< List entry for the _vfs_mount_list list */
+    vfs_mount_t *hash_next;      /**< Next mount in the same bucket of the mount index */
     const vfs_file_system_t *fs; /**< The file system driver for the mount point */
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
@@ -297,6 +308,16 @@ struct vfs_file_ops {
      */
     int (*fstat) (vfs_file_t *filp, struct stat *buf);
 
+    /**
+     * @brief Write all buffered data of an open file to the storage device
+     *
+     * @param[in]  filp     pointer to open file
+     *
+     * @return 0 on success
+     * @return <0 on error
+     */
+    int (*fsync) (vfs_file_t *filp);
+
     /**
      * @brief Seek to position in file
      *
@@ -601,6 +622,19 @@ int vfs_fcntl(int fd, int cmd, int arg);
  */
 int vfs_fstat(int fd, struct stat *buf);
 
+/**
+ * @brief Write all buffered data of an open file to the storage device
+ *
+ * File systems that do not buffer any data do not need to implement this,
+ * for those the call always succeeds.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ *
+ * @return 0 on success
+ * @return <0 on error
+ */
+int vfs_fsync(int fd);
+
 /**
  * @brief Get file system status of the file system containing an open file
  *
@@ -123,6 +123,25 @@
  * the time keeping is done by keeping track of the absolute times.
  *
  *
+ * ## Timing wheel
+ *
+ * The sorted list makes ztimer_set() walk past all timers that expire
+ * earlier, with interrupts disabled. On clocks with many concurrently active
+ * timers, the `ztimer_wheel` module can be used instead. It stores the
+ * absolute target time in each entry and sorts the timers into a hierarchical
+ * timing wheel of @ref ZTIMER_WHEEL_LEVELS levels with
+ * @ref ZTIMER_WHEEL_SLOTS slots each, where a timer is placed into the level
+ * of the most significant bit in which its target differs from the current
+ * time. Setting and removing a timer are then constant time operations. Only
+ * the closest slot is ever programmed into the underlying clock: when a slot
+ * of an upper level is reached, its timers are re-sorted ("cascaded") into
+ * the lower levels, which happens at most once per level for each timer.
+ * Timers that expire at the very same tick may trigger in any order.
+ *
+ * This costs @ref ZTIMER_WHEEL_LEVELS * @ref ZTIMER_WHEEL_SLOTS pointers of
+ * RAM per clock and one additional pointer per timer.
+ *
+ *
  * ## Clock extension
  *
  * The API always allows setting full 32bit relative offsets for every clock.
@@ -228,6 +247,27 @@ extern "C" {
  */
 #define ZTIMER_CLOCK_NO_REQUIRED_PM_MODE (UINT8_MAX)
 
+/**
+ * @brief   Number of bits of a timer target handled by each level of the
+ *          timing wheel
+ *
+ * Only used with the `ztimer_wheel` module. Must be between 1 and 5.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SLOT_BITS
+#define CONFIG_ZTIMER_WHEEL_SLOT_BITS       (4)
+#endif
+
+/**
+ * @brief   Number of slots per level of the timing wheel
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Number of levels of the timing wheel, covering 32 bit
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32 + CONFIG_ZTIMER_WHEEL_SLOT_BITS - 1) / \
+                                 CONFIG_ZTIMER_WHEEL_SLOT_BITS)
+
 /**
  * @brief ztimer_base_t forward declaration
  */
@@ -243,9 +283,29 @@ typedef struct ztimer_clock ztimer_clock_t;
  */
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    uint32_t offset;            /**< offset from last timer in list, or
+                                 *   absolute target with `ztimer_wheel` */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< pointer to the pointer referencing this
+                                 *   timer, NULL if not set */
+#endif
 };
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   Timing wheel of a clock
+ *
+ * @see     @ref sys_ztimer_wheel
+ */
+typedef struct {
+    uint32_t used[ZTIMER_WHEEL_LEVELS];     /**< bitmap of non-empty slots
+                                             *   per level */
+    ztimer_base_t *slot[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS]; /**< slots */
+    ztimer_base_t *wrapped;                 /**< timers with a target behind
+                                             *   the 32 bit wrap-around */
+} ztimer_wheel_t;
+#endif
+
 #if MODULE_ZTIMER_NOW64
 typedef uint64_t ztimer_now_t;  /**< type for ztimer_now() result */
 #else
@@ -292,7 +352,8 @@ typedef struct {
  * @brief   ztimer device structure
  */
 struct ztimer_clock {
-    ztimer_base_t list;             /**< list of active timers              */
+    ztimer_base_t list;             /**< list of active timers, or of
+                                         expired timers with `ztimer_wheel` */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
     uint32_t adjust;                /**< will be subtracted on every set()  */
@@ -305,6 +366,9 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t wheel;           /**< timing wheel of active timers      */
+#endif
 };
 
 /**
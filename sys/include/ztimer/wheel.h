@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_wheel  ztimer timing wheel
+ * @ingroup     sys_ztimer
+ * @brief       Hierarchical timing wheel to store the active timers of a clock
+ *
+ * When the `ztimer_wheel` module is used, every clock keeps its timers in a
+ * @ref ztimer_wheel_t instead of a sorted list, so ztimer_set() and
+ * ztimer_remove() no longer depend on the number of active timers. See
+ * section "Timing wheel" in @ref sys_ztimer for the design.
+ *
+ * These functions are used by the ztimer core and are not meant to be called
+ * by applications. They must be called with interrupts disabled.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer timing wheel internal API
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Adds a timer to the timing wheel of a clock
+ *
+ * @pre `entry` is not set
+ *
+ * @param[in] clock     clock to operate on
+ * @param[in] entry     timer with ztimer_base_t::offset set to the ticks
+ *                      relative to the base time of @p clock
+ *                      (ztimer_clock_t::list::offset). Will be replaced by the
+ *                      absolute target.
+ */
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Removes a timer from the timing wheel or the expired timers of a
+ *          clock
+ *
+ * @pre `entry` is set on @p clock
+ *
+ * @param[in] clock     clock to operate on
+ * @param[in] entry     timer to remove
+ */
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Advances the base time of a clock, moving all timers that expired
+ *          up to @p now to the list of expired timers
+ *
+ * @param[in] clock     clock to operate on
+ * @param[in] now       current time of @p clock
+ */
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now);
+
+/**
+ * @brief   Gets the ticks until the next event of a clock
+ *
+ * The next event is either the expiry of a timer or the point in time where a
+ * slot of an upper level of the wheel needs to be cascaded.
+ *
+ * @param[in] clock     clock to operate on
+ * @param[out] offset   ticks relative to the base time of @p clock. 0, if
+ *                      there are expired timers.
+ *
+ * @return  true, if there is an event pending
+ * @return  false, if no timer is set on @p clock
+ */
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset);
+
+/**
+ * @brief   Takes the next expired timer from a clock
+ *
+ * @param[in] clock     clock to operate on
+ *
+ * @return  the next expired timer
+ * @return  NULL, if no timer expired
+ */
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock);
+
+/**
+ * @brief   Checks if any timer is set on a clock
+ *
+ * @param[in] clock     clock to operate on
+ *
+ * @return  true, if no timer is set on @p clock
+ */
+bool ztimer_wheel_is_empty(const ztimer_clock_t *clock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
@@ -44,6 +44,17 @@
 /* End of the range to pick a random timeout */
 #define TIMEOUT_RANGE_END (CONFIG_COAP_ACK_TIMEOUT * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000)
 
+#define REQ_HASH_MASK   (CONFIG_GCOAP_REQ_HASH_BUCKETS - 1)
+#define OBS_HASH_MASK   (CONFIG_GCOAP_OBS_HASH_BUCKETS - 1)
+
+static_assert((CONFIG_GCOAP_REQ_HASH_BUCKETS & REQ_HASH_MASK) == 0,
+              "CONFIG_GCOAP_REQ_HASH_BUCKETS must be a power of two");
+static_assert((CONFIG_GCOAP_OBS_HASH_BUCKETS & OBS_HASH_MASK) == 0,
+              "CONFIG_GCOAP_OBS_HASH_BUCKETS must be a power of two");
+static_assert((CONFIG_GCOAP_REQ_WAITING_MAX < UINT16_MAX) &&
+              (CONFIG_GCOAP_OBS_REGISTRATIONS_MAX < UINT16_MAX),
+              "memo indexes must fit into 16 bits");
+
 /* Internal functions */
 static void *_event_loop(void *arg);
 static void _on_sock_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg);
@@ -60,6 +71,10 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+static void _release_req_memo(gcoap_request_memo_t *memo);
+static void _obs_memo_link(gcoap_observe_memo_t *memo);
+static void _obs_memo_unlink(gcoap_observe_memo_t *memo);
+static void _obs_memo_free(gcoap_observe_memo_t *memo);
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -81,12 +96,35 @@ typedef struct {
                                         /* Storage for open requests; if first
                                            byte of an entry is zero, the entry
                                            is available */
+    /* The memo indexes below hold the array index + 1 of a memo, so 0 ends
+     * a chain. Protected by lock. */
+    uint16_t req_buckets[CONFIG_GCOAP_REQ_HASH_BUCKETS];
+                                        /* Open requests by token and remote
+                                           port */
+    uint16_t req_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+                                        /* Next open request in the same
+                                           bucket, or next unused one */
+    uint16_t req_free;                  /* First unused request memo */
     atomic_uint next_message_id;        /* Next message ID to use */
     sock_udp_ep_t observers[CONFIG_GCOAP_OBS_CLIENTS_MAX];
                                         /* Observe clients; allows reuse for
                                            observe memos */
+    uint16_t observer_memos[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                        /* Number of registrations of each
+                                           observe client */
     gcoap_observe_memo_t observe_memos[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
                                         /* Observed resource registrations */
+    uint16_t obs_res_buckets[CONFIG_GCOAP_OBS_HASH_BUCKETS];
+                                        /* Registrations by resource */
+    uint16_t obs_res_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Next registration in the same
+                                           resource bucket */
+    uint16_t obs_token_buckets[CONFIG_GCOAP_OBS_HASH_BUCKETS];
+                                        /* Registrations by client and token */
+    uint16_t obs_token_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Next registration in the same token
+                                           bucket, or next unused one */
+    uint16_t obs_free;                  /* First unused registration */
     uint8_t resend_bufs[CONFIG_GCOAP_RESEND_BUFS_MAX][CONFIG_GCOAP_PDU_BUF_SIZE];
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
@@ -177,8 +215,14 @@ static void _on_sock_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
                 size_t pdu_len = _handle_req(&pdu, _listen_buf, sizeof(_listen_buf),
                                              &remote);
                 if (pdu_len > 0) {
-                    ssize_t bytes = sock_udp_send(sock, _listen_buf, pdu_len,
-                                                  &remote);
+                    /* send payload snips of the handler without copying them
+                     * into the listen buffer */
+                    iolist_t head = {
+                        .iol_next = pdu.snips,
+                        .iol_base = _listen_buf,
+                        .iol_len = pdu_len,
+                    };
+                    ssize_t bytes = sock_udp_sendv(sock, &head, &remote);
                     if (bytes <= 0) {
                         DEBUG("gcoap: send response failed: %d\n", (int)bytes);
                     }
@@ -210,10 +254,8 @@ empty_as_response:
                         memo->resp_handler(memo, &pdu, &remote);
                     }
 
-                    if (memo->send_limit >= 0) {        /* if confirmable */
-                        *memo->msg.data.pdu_buf = 0;    /* clear resend PDU buffer */
-                    }
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    /* also clears resend PDU buffer, if confirmable */
+                    _release_req_memo(memo);
                     break;
                 case COAP_TYPE_CON:
                     DEBUG("gcoap: separate CON response not handled yet\n");
@@ -287,11 +329,13 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
     }
 
+    mutex_lock(&_coap_state.lock);
+    /* find observe registration for resource */
+    _find_obs_memo_resource(&resource_memo, resource);
+
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, pdu);
@@ -326,8 +370,11 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                     }
                 }
                 if (observer != NULL) {
+                    /* take the unused memo from the free list */
                     memo = &_coap_state.observe_memos[empty_slot];
+                    _coap_state.obs_free = _coap_state.obs_token_next[empty_slot];
                     memo->observer = observer;
+                    _coap_state.observer_memos[observer - _coap_state.observers]++;
                 }
             }
             if (memo == NULL) {
@@ -337,12 +384,17 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         }
         /* finish registration */
         if (memo != NULL) {
+            /* re-index the memo, as resource and token may change */
+            if (memo->resource != NULL) {
+                _obs_memo_unlink(memo);
+            }
             /* resource may be assigned here if it is not already registered */
             memo->resource = resource;
             memo->token_len = coap_get_token_len(pdu);
             if (memo->token_len) {
                 memcpy(&memo->token[0], pdu->token, memo->token_len);
             }
+            _obs_memo_link(memo);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -350,27 +402,28 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         _find_obs_memo(&memo, remote, pdu);
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
+            unsigned obs_slot = memo->observer - _coap_state.observers;
+
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
-            memo->observer = NULL;
-            memo           = NULL;
-            _find_obs_memo(&memo, remote, NULL);
-            if (memo == NULL) {
-                _find_observer(&observer, remote);
-                if (observer != NULL) {
-                    observer->family = AF_UNSPEC;
-                }
+            _obs_memo_unlink(memo);
+            _obs_memo_free(memo);
+            if (--_coap_state.observer_memos[obs_slot] == 0) {
+                _coap_state.observers[obs_slot].family = AF_UNSPEC;
             }
         }
         coap_clear_observe(pdu);
 
     } else if (coap_has_observe(pdu)) {
+        mutex_unlock(&_coap_state.lock);
         /* bogus request; don't respond */
         DEBUG("gcoap: Observe value unexpected: %" PRIu32 "\n", coap_get_observe(pdu));
         return -1;
     }
+    mutex_unlock(&_coap_state.lock);
 
     ssize_t pdu_len = resource->handler(pdu, buf, len, resource->context);
     if (pdu_len < 0) {
+        pdu->snips = NULL;
         pdu_len = gcoap_response(pdu, buf, len,
                                  COAP_CODE_INTERNAL_SERVER_ERROR);
     }
@@ -402,30 +455,18 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     }
 
     while (listener) {
-        const coap_resource_t *resource = listener->resources;
-        for (size_t i = 0; i < listener->resources_len; i++) {
-            if (i) {
-                resource++;
-            }
-
-            int res = coap_match_path(resource, uri);
-            if (res > 0) {
-                continue;
-            }
-            else if (res < 0) {
-                /* resources expected in alphabetical order */
-                break;
-            }
-            else {
-                if (! (resource->methods & method_flag)) {
-                    ret = GCOAP_RESOURCE_WRONG_METHOD;
-                    continue;
-                }
-
-                *resource_ptr = resource;
-                *listener_ptr = listener;
-                return GCOAP_RESOURCE_FOUND;
-            }
+        bool path_found = false;
+        const coap_resource_t *resource = coap_find_resource(
+                listener->resources, listener->resources_len, uri,
+                method_flag, &path_found);
+
+        if (resource) {
+            *resource_ptr = resource;
+            *listener_ptr = listener;
+            return GCOAP_RESOURCE_FOUND;
+        }
+        if (path_found) {
+            ret = GCOAP_RESOURCE_WRONG_METHOD;
         }
         listener = listener->next;
     }
@@ -433,6 +474,100 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     return ret;
 }
 
+/*
+ * FNV-1a hash of a memo key
+ */
+static unsigned _hash(const uint8_t *key, size_t key_len, uint32_t seed)
+{
+    uint32_t hash = 2166136261U ^ seed;
+
+    for (unsigned i = 0; i < key_len; i++) {
+        hash = (hash ^ key[i]) * 16777619U;
+    }
+    return hash ^ (hash >> 16);
+}
+
+/*
+ * Hash bucket in _coap_state.req_buckets for the token of a request and the
+ * endpoint it was sent to.
+ */
+static inline unsigned _req_bucket(const uint8_t *token, unsigned token_len,
+                                   const sock_udp_ep_t *remote)
+{
+    return _hash(token, token_len, remote->port) & REQ_HASH_MASK;
+}
+
+/*
+ * Sets the header of the request PDU stored in a request memo to memo_pdu.
+ */
+static void _req_memo_pdu(gcoap_request_memo_t *memo, coap_pkt_t *memo_pdu)
+{
+    if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
+        memo_pdu->hdr = (coap_hdr_t *) &memo->msg.hdr_buf[0];
+    }
+    else {
+        memo_pdu->hdr = (coap_hdr_t *) memo->msg.data.pdu_buf;
+    }
+    memo_pdu->token = coap_hdr_data_ptr(memo_pdu->hdr);
+}
+
+static unsigned _req_memo_bucket(gcoap_request_memo_t *memo)
+{
+    coap_pkt_t memo_pdu;
+
+    _req_memo_pdu(memo, &memo_pdu);
+    return _req_bucket(memo_pdu.token, coap_get_token_len(&memo_pdu),
+                       &memo->remote_ep);
+}
+
+/*
+ * Adds a request memo with its request PDU set to the index. Requires lock.
+ */
+static void _req_memo_link(gcoap_request_memo_t *memo)
+{
+    unsigned idx = memo - _coap_state.open_reqs;
+    uint16_t *bucket = &_coap_state.req_buckets[_req_memo_bucket(memo)];
+
+    _coap_state.req_next[idx] = *bucket;
+    *bucket = idx + 1;
+}
+
+/*
+ * Returns a request memo to the free list. Requires lock.
+ */
+static void _req_memo_free(gcoap_request_memo_t *memo)
+{
+    unsigned idx = memo - _coap_state.open_reqs;
+
+    memo->state = GCOAP_MEMO_UNUSED;
+    _coap_state.req_next[idx] = _coap_state.req_free;
+    _coap_state.req_free = idx + 1;
+}
+
+/*
+ * Removes a request memo from the index, clears its resend buffer if
+ * confirmable and returns it to the free list.
+ */
+static void _release_req_memo(gcoap_request_memo_t *memo)
+{
+    uint16_t *next;
+    unsigned idx = memo - _coap_state.open_reqs;
+
+    mutex_lock(&_coap_state.lock);
+    /* the bucket depends on the stored PDU, so unlink before clearing it */
+    next = &_coap_state.req_buckets[_req_memo_bucket(memo)];
+    while (*next != (idx + 1)) {
+        assert(*next != 0);
+        next = &_coap_state.req_next[*next - 1];
+    }
+    *next = _coap_state.req_next[idx];
+    if (memo->send_limit != GCOAP_SEND_LIMIT_NON) {
+        *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
+    }
+    _req_memo_free(memo);
+    mutex_unlock(&_coap_state.lock);
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -450,28 +585,23 @@ static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
     coap_pkt_t *memo_pdu = &memo_pdu_data;
     unsigned cmplen      = coap_get_token_len(src_pdu);
 
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-        if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
-            memo_pdu->hdr = (coap_hdr_t *) &memo->msg.hdr_buf[0];
-        }
-        else {
-            memo_pdu->hdr = (coap_hdr_t *) memo->msg.data.pdu_buf;
-        }
+    mutex_lock(&_coap_state.lock);
+    unsigned idx = _coap_state.req_buckets[_req_bucket(src_pdu->token, cmplen,
+                                                       remote)];
+    while (idx > 0) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[idx - 1];
 
+        _req_memo_pdu(memo, memo_pdu);
         if (coap_get_token_len(memo_pdu) == cmplen) {
-            memo_pdu->token = coap_hdr_data_ptr(memo_pdu->hdr);
             if ((memcmp(src_pdu->token, memo_pdu->token, cmplen) == 0)
                     && sock_udp_ep_equal(&memo->remote_ep, remote)) {
                 *memo_ptr = memo;
                 break;
             }
         }
+        idx = _coap_state.req_next[idx - 1];
     }
+    mutex_unlock(&_coap_state.lock);
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -491,10 +621,8 @@ static void _expire_request(gcoap_request_memo_t *memo)
             }
             memo->resp_handler(memo, &req, NULL);
         }
-        if (memo->send_limit != GCOAP_SEND_LIMIT_NON) {
-            *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
-        }
-        memo->state = GCOAP_MEMO_UNUSED;
+        /* also clears resend buffer, if confirmable */
+        _release_req_memo(memo);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -520,6 +648,81 @@ static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t le
     return plen;
 }
 
+/*
+ * Hash bucket in _coap_state.obs_res_buckets for an observed resource.
+ */
+static inline unsigned _obs_res_bucket(const coap_resource_t *resource)
+{
+    return _hash((uint8_t *)&resource, sizeof(resource), 0) & OBS_HASH_MASK;
+}
+
+/*
+ * Hash bucket in _coap_state.obs_token_buckets for a token of an observe
+ * client.
+ */
+static inline unsigned _obs_token_bucket(const sock_udp_ep_t *observer,
+                                         const uint8_t *token,
+                                         unsigned token_len)
+{
+    return _hash(token, token_len, observer - _coap_state.observers) &
+           OBS_HASH_MASK;
+}
+
+/*
+ * Adds a registered observe memo to the indexes by resource and token.
+ * Requires lock.
+ */
+static void _obs_memo_link(gcoap_observe_memo_t *memo)
+{
+    unsigned idx = memo - _coap_state.observe_memos;
+    uint16_t *bucket;
+
+    bucket = &_coap_state.obs_res_buckets[_obs_res_bucket(memo->resource)];
+    _coap_state.obs_res_next[idx] = *bucket;
+    *bucket = idx + 1;
+    bucket = &_coap_state.obs_token_buckets[
+        _obs_token_bucket(memo->observer, memo->token, memo->token_len)];
+    _coap_state.obs_token_next[idx] = *bucket;
+    *bucket = idx + 1;
+}
+
+/*
+ * Removes an observe memo from the indexes by resource and token. Requires
+ * lock.
+ */
+static void _obs_memo_unlink(gcoap_observe_memo_t *memo)
+{
+    unsigned idx = memo - _coap_state.observe_memos;
+    uint16_t *next;
+
+    next = &_coap_state.obs_res_buckets[_obs_res_bucket(memo->resource)];
+    while (*next != (idx + 1)) {
+        assert(*next != 0);
+        next = &_coap_state.obs_res_next[*next - 1];
+    }
+    *next = _coap_state.obs_res_next[idx];
+    next = &_coap_state.obs_token_buckets[
+        _obs_token_bucket(memo->observer, memo->token, memo->token_len)];
+    while (*next != (idx + 1)) {
+        assert(*next != 0);
+        next = &_coap_state.obs_token_next[*next - 1];
+    }
+    *next = _coap_state.obs_token_next[idx];
+}
+
+/*
+ * Clears an observe memo and returns it to the free list. Requires lock.
+ */
+static void _obs_memo_free(gcoap_observe_memo_t *memo)
+{
+    unsigned idx = memo - _coap_state.observe_memos;
+
+    memo->observer = NULL;
+    memo->resource = NULL;
+    _coap_state.obs_token_next[idx] = _coap_state.obs_free;
+    _coap_state.obs_free = idx + 1;
+}
+
 /*
  * Find registered observer for a remote address and port.
  *
@@ -547,11 +750,11 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 }
 
 /*
- * Find registered observe memo for a remote address and token.
+ * Find registered observe memo for a remote address and token. Requires lock.
  *
  * memo[out] -- Registered observe memo, or NULL if not found
  * remote[in] -- Endpoint for address to match
- * pdu[in] -- PDU for token to match, or NULL to match only on remote address
+ * pdu[in] -- PDU for token to match
  *
  * return Index of empty slot, suitable for registering new memo; or -1 if no
  *        empty slots. Undefined if memo found.
@@ -559,40 +762,33 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu)
 {
-    int empty_slot = -1;
-    *memo          = NULL;
+    *memo = NULL;
 
     sock_udp_ep_t *remote_observer = NULL;
     _find_observer(&remote_observer, remote);
 
-    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer == NULL) {
-            empty_slot = i;
-            continue;
-        }
+    unsigned cmplen = coap_get_token_len(pdu);
+    if ((remote_observer != NULL) && cmplen) {
+        unsigned idx = _coap_state.obs_token_buckets[
+            _obs_token_bucket(remote_observer, pdu->token, cmplen)];
 
-        if (_coap_state.observe_memos[i].observer == remote_observer) {
-            if (pdu == NULL) {
-                *memo = &_coap_state.observe_memos[i];
-                break;
-            }
+        while (idx > 0) {
+            gcoap_observe_memo_t *obs_memo = &_coap_state.observe_memos[idx - 1];
 
-            if (_coap_state.observe_memos[i].token_len == coap_get_token_len(pdu)) {
-                unsigned cmplen = _coap_state.observe_memos[i].token_len;
-                if (cmplen &&
-                        memcmp(&_coap_state.observe_memos[i].token[0], &pdu->token[0],
-                                                                       cmplen) == 0) {
-                    *memo = &_coap_state.observe_memos[i];
-                    break;
-                }
+            if ((obs_memo->observer == remote_observer) &&
+                (obs_memo->token_len == cmplen) &&
+                (memcmp(&obs_memo->token[0], &pdu->token[0], cmplen) == 0)) {
+                *memo = obs_memo;
+                break;
             }
+            idx = _coap_state.obs_token_next[idx - 1];
         }
     }
-    return empty_slot;
+    return (int)_coap_state.obs_free - 1;
 }
 
 /*
- * Find registered observe memo for a resource.
+ * Find registered observe memo for a resource. Requires lock.
  *
  * memo[out] -- Registered observe memo, or NULL if not found
  * resource[in] -- Resource to match
@@ -601,12 +797,14 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
-    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
+
+    unsigned idx = _coap_state.obs_res_buckets[_obs_res_bucket(resource)];
+    while (idx > 0) {
+        if (_coap_state.observe_memos[idx - 1].resource == resource) {
+            *memo = &_coap_state.observe_memos[idx - 1];
             break;
         }
+        idx = _coap_state.obs_res_next[idx - 1];
     }
 }
 
@@ -626,8 +824,25 @@ kernel_pid_t gcoap_init(void)
     /* Blank lists so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
+    memset(&_coap_state.observer_memos[0], 0, sizeof(_coap_state.observer_memos));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+    /* Chain all memos in the free lists, with empty indexes. */
+    memset(&_coap_state.req_buckets[0], 0, sizeof(_coap_state.req_buckets));
+    for (unsigned i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        _coap_state.req_next[i] = i + 2;
+    }
+    _coap_state.req_next[CONFIG_GCOAP_REQ_WAITING_MAX - 1] = 0;
+    _coap_state.req_free = 1;
+    memset(&_coap_state.obs_res_buckets[0], 0,
+           sizeof(_coap_state.obs_res_buckets));
+    memset(&_coap_state.obs_token_buckets[0], 0,
+           sizeof(_coap_state.obs_token_buckets));
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        _coap_state.obs_token_next[i] = i + 2;
+    }
+    _coap_state.obs_token_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX - 1] = 0;
+    _coap_state.obs_free = 1;
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -642,6 +857,14 @@ void gcoap_register_listener(gcoap_listener_t *listener)
         _last = _last->next;
     }
 
+#ifdef DEVELHELP
+    for (size_t i = 1; i < listener->resources_len; i++) {
+        /* resources are looked up with a binary search */
+        assert(strcmp(listener->resources[i - 1].path,
+                      listener->resources[i].path) <= 0);
+    }
+#endif
+
     listener->next = NULL;
     if (!listener->link_encoder) {
         listener->link_encoder = gcoap_encode_link;
@@ -740,13 +963,11 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
      * response or request is confirmable) */
     if ((resp_handler != NULL) || (msg_type == COAP_TYPE_CON)) {
         mutex_lock(&_coap_state.lock);
-        /* Find empty slot in list of open requests. */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-            if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-                memo = &_coap_state.open_reqs[i];
-                memo->state = GCOAP_MEMO_WAIT;
-                break;
-            }
+        /* Take empty slot from the list of unused requests. */
+        if (_coap_state.req_free > 0) {
+            memo = &_coap_state.open_reqs[_coap_state.req_free - 1];
+            _coap_state.req_free = _coap_state.req_next[_coap_state.req_free - 1];
+            memo->state = GCOAP_MEMO_WAIT;
         }
         if (!memo) {
             mutex_unlock(&_coap_state.lock);
@@ -794,10 +1015,13 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
-        mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
+            _req_memo_free(memo);
+            mutex_unlock(&_coap_state.lock);
             return 0;
         }
+        _req_memo_link(memo);
+        mutex_unlock(&_coap_state.lock);
     }
 
     /* set response timeout; may be zero for non-confirmable */
@@ -816,13 +1040,11 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
     ssize_t res = sock_udp_send(&_sock, buf, len, remote);
     if (res <= 0) {
         if (memo != NULL) {
-            if (msg_type == COAP_TYPE_CON) {
-                *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
-            }
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
+            /* also clears resend buffer, if confirmable */
+            _release_req_memo(memo);
         }
         DEBUG("gcoap: sock send failed: %d\n", (int)res);
     }
@@ -857,8 +1079,10 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 {
     gcoap_observe_memo_t *memo = NULL;
 
+    mutex_lock(&_coap_state.lock);
     _find_obs_memo_resource(&memo, resource);
     if (memo == NULL) {
+        mutex_unlock(&_coap_state.lock);
         /* Unique return value to specify there is not an observer */
         return GCOAP_OBS_INIT_UNUSED;
     }
@@ -867,6 +1091,7 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     uint16_t msgid = (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
     ssize_t hdrlen = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, &memo->token[0],
                                     memo->token_len, COAP_CODE_CONTENT, msgid);
+    mutex_unlock(&_coap_state.lock);
 
     if (hdrlen > 0) {
         coap_pkt_init(pdu, buf, len - CONFIG_GCOAP_OBS_OPTIONS_BUF, hdrlen);
@@ -883,15 +1108,20 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     }
 }
 
-size_t gcoap_obs_send(const uint8_t *buf, size_t len,
-                      const coap_resource_t *resource)
+static size_t _obs_send(iolist_t *pdu, const coap_resource_t *resource)
 {
     gcoap_observe_memo_t *memo = NULL;
+    sock_udp_ep_t remote;
 
+    mutex_lock(&_coap_state.lock);
     _find_obs_memo_resource(&memo, resource);
+    if (memo) {
+        remote = *memo->observer;
+    }
+    mutex_unlock(&_coap_state.lock);
 
     if (memo) {
-        ssize_t bytes = sock_udp_send(&_sock, buf, len, memo->observer);
+        ssize_t bytes = sock_udp_sendv(&_sock, pdu, &remote);
         return (size_t)((bytes > 0) ? bytes : 0);
     }
     else {
@@ -899,6 +1129,29 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     }
 }
 
+size_t gcoap_obs_send(const uint8_t *buf, size_t len,
+                      const coap_resource_t *resource)
+{
+    iolist_t head = {
+        .iol_base = (void *)buf,
+        .iol_len = len,
+    };
+
+    return _obs_send(&head, resource);
+}
+
+size_t gcoap_obs_send_pdu(const coap_pkt_t *pdu, size_t len,
+                          const coap_resource_t *resource)
+{
+    iolist_t head = {
+        .iol_next = pdu->snips,
+        .iol_base = pdu->hdr,
+        .iol_len = len,
+    };
+
+    return _obs_send(&head, resource);
+}
+
 uint8_t gcoap_op_state(void)
 {
     uint8_t count = 0;
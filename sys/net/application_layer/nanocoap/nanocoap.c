@@ -68,6 +68,7 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
 
     pkt->payload = NULL;
     pkt->payload_len = 0;
+    pkt->snips = NULL;
 
     if (len < sizeof(coap_hdr_t)) {
         DEBUG("msg too short\n");
@@ -414,25 +415,95 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
-    for (unsigned i = 0; i < resources_numof; i++) {
-        const coap_resource_t *resource = &resources[i];
-        if (!(resource->methods & method_flag)) {
-            continue;
+    const coap_resource_t *resource = coap_find_resource(resources,
+                                                         resources_numof, uri,
+                                                         method_flag, NULL);
+    if (resource != NULL) {
+        return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
+    }
+
+    return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+}
+
+/* strcmp() of the first len characters of uri against path */
+static int _cmp_uri_prefix(const char *uri, size_t len, const char *path)
+{
+    int res = strncmp(uri, path, len);
+
+    if (res != 0) {
+        return res;
+    }
+    return (path[len] == '\0') ? 0 : -1;
+}
+
+const coap_resource_t *coap_find_resource(const coap_resource_t *resources,
+                                          size_t resources_numof,
+                                          const uint8_t *uri,
+                                          coap_method_flags_t method_flag,
+                                          bool *path_found)
+{
+    const char *u = (const char *)uri;
+    const coap_resource_t *res = NULL;
+    size_t uri_len = strlen(u);
+    size_t len = uri_len;
+    size_t end = resources_numof;
+
+    /* All resources matching the URI are prefixes of it and every path that
+     * sorts between such a prefix and the URI starts with the prefix. So
+     * the last path not sorting after the first len characters of the URI is
+     * either a prefix of them or shares a shorter common prefix with them,
+     * that bounds all remaining candidates. Candidates are visited from the
+     * longest to the shortest path, i.e. against the order of the array. */
+    while (end > 0) {
+        size_t lo = 0, hi = end;
+
+        while (lo < hi) {
+            size_t mid = lo + ((hi - lo) / 2);
+
+            if (_cmp_uri_prefix(u, len, resources[mid].path) < 0) {
+                hi = mid;
+            }
+            else {
+                lo = mid + 1;
+            }
+        }
+        if (lo == 0) {
+            break;
         }
 
-        int res = coap_match_path(resource, uri);
-        if (res > 0) {
+        const char *path = resources[lo - 1].path;
+        size_t common = 0;
+
+        while ((common < len) && (path[common] == u[common])) {
+            common++;
+        }
+        if (path[common] != '\0') {
+            /* no prefix of the URI, but shares the first common chars */
+            len = common;
+            end = lo - 1;
             continue;
         }
-        else if (res < 0) {
+        /* check all resources with this path, lowest index wins */
+        end = lo;
+        do {
+            const coap_resource_t *resource = &resources[--end];
+
+            if ((common == uri_len) ||
+                (resource->methods & COAP_MATCH_SUBTREE)) {
+                if (resource->methods & method_flag) {
+                    res = resource;
+                }
+                else if (path_found != NULL) {
+                    *path_found = true;
+                }
+            }
+        } while ((end > 0) && (strcmp(resources[end - 1].path, path) == 0));
+        if (common == 0) {
             break;
         }
-        else {
-            return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
-        }
+        len = common - 1;
     }
-
-    return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+    return res;
 }
 
 ssize_t coap_reply_simple(coap_pkt_t *pkt,
@@ -52,7 +52,13 @@ ssize_t nanocoap_request(coap_pkt_t *pkt, sock_udp_ep_t *local, sock_udp_ep_t *r
     unsigned tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;  /* add 1 for initial transmit */
     while (tries_left) {
 
-        res = sock_udp_send(&sock, buf, pdu_len, NULL);
+        iolist_t head = {
+            .iol_next = pkt->snips,
+            .iol_base = buf,
+            .iol_len = pdu_len,
+        };
+
+        res = sock_udp_sendv(&sock, &head, NULL);
         if (res <= 0) {
             DEBUG("nanocoap: error sending coap request, %d\n", (int)res);
             break;
@@ -98,6 +104,7 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf, size
     pktpos += coap_opt_put_uri_path(pktpos, 0, path);
     pkt.payload = pktpos;
     pkt.payload_len = 0;
+    pkt.snips = NULL;
 
     res = nanocoap_request(&pkt, NULL, remote, len);
     if (res < 0) {
@@ -144,7 +151,15 @@ int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
                 continue;
             }
             if ((res = coap_handle_req(&pkt, buf, bufsize)) > 0) {
-                sock_udp_send(&sock, buf, res, &remote);
+                /* a handler may have attached payload snips to the request
+                 * for its response */
+                iolist_t head = {
+                    .iol_next = pkt.snips,
+                    .iol_base = buf,
+                    .iol_len = res,
+                };
+
+                sock_udp_sendv(&sock, &head, &remote);
             }
             else {
                 DEBUG("error handling request %d\n", (int)res);
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *               2019 Inria
+ *               2019 Kaspar Schleiser <kaspar@schleiser.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_nanocoap
+ * @{
+ *
+ * @file
+ * @brief       Nanocoap block-wise GET with several blocks in flight
+ *
+ * @author      Koen Zandberg <koen@bergzand.net>
+ * @author      Kaspar Schleiser <kaspar@schleiser.de>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "net/nanocoap_sock.h"
+#include "net/sock/udp.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief   Room for the CoAP header and options of a block request or response
+ */
+#define BLOCKWISE_HDR_SPACE     (64U)
+
+enum {
+    BLOCK_FREE = 0,         /**< slot is unused */
+    BLOCK_SENT,             /**< request sent, waiting for the response */
+    BLOCK_DONE,             /**< response received out of order, buffered */
+    BLOCK_FAILED,           /**< server answered with an error */
+};
+
+/* state of one block request in the window */
+typedef struct {
+    size_t num;             /* block number, its lower bits are the msg id */
+    uint32_t deadline;      /* next retransmission */
+    uint32_t timeout;       /* current retransmission timeout */
+    uint16_t len;           /* length of the buffered payload */
+    uint8_t tries_left;     /* transmissions left, including the current */
+    uint8_t state;
+    int8_t more;            /* more flag of the buffered block */
+} _block_t;
+
+static int _send_request(sock_udp_t *sock, uint8_t *buf, const char *path,
+                         coap_blksize_t blksize, _block_t *block)
+{
+    uint8_t *pktpos = buf;
+
+    pktpos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                             COAP_METHOD_GET, block->num);
+    pktpos += coap_opt_put_uri_path(pktpos, 0, path);
+    pktpos += coap_opt_put_uint(pktpos, COAP_OPT_URI_PATH, COAP_OPT_BLOCK2,
+                                (block->num << 4) | blksize);
+
+    DEBUG("nanocoap: requesting block %u\n", (unsigned)block->num);
+    block->deadline = xtimer_now_usec() + block->timeout;
+
+    ssize_t res = sock_udp_send(sock, buf, pktpos - buf, NULL);
+    return (res < 0) ? (int)res : 0;
+}
+
+static uint32_t _next_timeout(const _block_t *blocks, unsigned window)
+{
+    uint32_t now = xtimer_now_usec();
+    uint32_t timeout = UINT32_MAX;
+
+    for (unsigned i = 0; i < window; i++) {
+        if (blocks[i].state == BLOCK_SENT) {
+            int32_t left = (int32_t)(blocks[i].deadline - now);
+
+            if (left <= 0) {
+                return 0;
+            }
+            if ((uint32_t)left < timeout) {
+                timeout = left;
+            }
+        }
+    }
+    return timeout;
+}
+
+static int _retransmit(sock_udp_t *sock, uint8_t *buf, const char *path,
+                       coap_blksize_t blksize, _block_t *blocks,
+                       unsigned window)
+{
+    uint32_t now = xtimer_now_usec();
+
+    for (unsigned i = 0; i < window; i++) {
+        _block_t *block = &blocks[i];
+
+        if ((block->state != BLOCK_SENT) ||
+            ((int32_t)(block->deadline - now) > 0)) {
+            continue;
+        }
+        if (--block->tries_left == 0) {
+            DEBUG("nanocoap: maximum retries reached\n");
+            return -ETIMEDOUT;
+        }
+        /* TODO: timeout random between between ACK_TIMEOUT and (ACK_TIMEOUT *
+         * ACK_RANDOM_FACTOR) */
+        block->timeout *= 2;
+        int res = _send_request(sock, buf, path, blksize, block);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+int nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                           coap_blksize_t blksize, unsigned window,
+                           coap_blockwise_cb_t callback, void *arg)
+{
+    const size_t blocksize = 1U << (blksize + 4);
+    /* mmmmh dynamically sized arrays */
+    uint8_t buf[BLOCKWISE_HDR_SPACE + blocksize];
+    uint8_t payload[window][blocksize];
+    _block_t blocks[window];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+    /* the next block to hand to the callback and the last one, once known */
+    size_t next = 0;
+    size_t last = SIZE_MAX;
+    int res;
+
+    assert(window > 0);
+
+    if (!remote->port) {
+        remote->port = COAP_PORT;
+    }
+    /* HACK: use random local port */
+    local.port = 0x8000 + (xtimer_now_usec() % 0XFFF);
+
+    res = sock_udp_create(&sock, &local, remote, 0);
+    if (res < 0) {
+        return res;
+    }
+    memset(blocks, 0, sizeof(blocks));
+
+    while (next <= last) {
+        if (blocks[next % window].state == BLOCK_FAILED) {
+            DEBUG("nanocoap: error fetching block %u\n", (unsigned)next);
+            res = -1;
+            goto out;
+        }
+
+        /* keep the window filled, blocks [next, next + window) map to
+         * distinct slots */
+        for (size_t num = next; (num < next + window) && (num <= last); num++) {
+            _block_t *block = &blocks[num % window];
+
+            if (block->state != BLOCK_FREE) {
+                continue;
+            }
+            block->num = num;
+            block->state = BLOCK_SENT;
+            block->timeout = CONFIG_COAP_ACK_TIMEOUT * US_PER_SEC;
+            /* add 1 for initial transmit */
+            block->tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;
+            if ((res = _send_request(&sock, buf, path, blksize, block)) < 0) {
+                goto out;
+            }
+        }
+
+        ssize_t len = sock_udp_recv(&sock, buf, sizeof(buf),
+                                    _next_timeout(blocks, window), NULL);
+        /* a deadline that passed already gives a timeout of 0, for which
+         * sock_udp_recv() returns -EAGAIN instead of -ETIMEDOUT */
+        if ((len == -ETIMEDOUT) || (len == -EAGAIN)) {
+            DEBUG("nanocoap: timeout\n");
+            res = _retransmit(&sock, buf, path, blksize, blocks, window);
+            if (res < 0) {
+                goto out;
+            }
+            continue;
+        }
+        else if (len < 0) {
+            DEBUG("nanocoap: error receiving coap response, %d\n", (int)len);
+            res = len;
+            goto out;
+        }
+
+        coap_pkt_t pkt;
+        if (coap_parse(&pkt, buf, len) < 0) {
+            DEBUG("nanocoap: error parsing packet\n");
+            continue;
+        }
+
+        /* match the response to an outstanding request */
+        _block_t *block = NULL;
+        for (unsigned i = 0; i < window; i++) {
+            if ((blocks[i].state == BLOCK_SENT) &&
+                ((uint16_t)blocks[i].num == coap_get_id(&pkt))) {
+                block = &blocks[i];
+                break;
+            }
+        }
+        if (block == NULL) {
+            /* duplicate or stray response */
+            continue;
+        }
+
+        coap_block1_t block2;
+        coap_get_block2(&pkt, &block2);
+        if ((coap_get_code(&pkt) != 205) ||
+            (block2.offset != block->num * blocksize) ||
+            (pkt.payload_len > blocksize)) {
+            DEBUG("nanocoap: block %u failed, code=%i\n",
+                  (unsigned)block->num, coap_get_code(&pkt));
+            block->state = BLOCK_FAILED;
+            continue;
+        }
+
+        if (block2.more != 1) {
+            last = block->num;
+            /* the requests beyond the end are of no use */
+            for (unsigned i = 0; i < window; i++) {
+                if (blocks[i].num > last) {
+                    blocks[i].state = BLOCK_FREE;
+                }
+            }
+        }
+
+        if (block->num != next) {
+            /* out of order, keep it until the gap is closed */
+            memcpy(payload[block->num % window], pkt.payload, pkt.payload_len);
+            block->len = pkt.payload_len;
+            block->more = block2.more;
+            block->state = BLOCK_DONE;
+            continue;
+        }
+
+        /* hand the block and all buffered blocks following it over */
+        if (callback(arg, block2.offset, pkt.payload, pkt.payload_len,
+                     block2.more)) {
+            DEBUG("callback res != 0, aborting.\n");
+            res = -1;
+            goto out;
+        }
+        block->state = BLOCK_FREE;
+        next++;
+
+        while ((next <= last) && (blocks[next % window].state == BLOCK_DONE)) {
+            block = &blocks[next % window];
+            if (callback(arg, next * blocksize, payload[next % window],
+                         block->len, block->more)) {
+                DEBUG("callback res != 0, aborting.\n");
+                res = -1;
+                goto out;
+            }
+            block->state = BLOCK_FREE;
+            next++;
+        }
+    }
+    res = 0;
+
+out:
+    sock_udp_close(&sock);
+    return res;
+}
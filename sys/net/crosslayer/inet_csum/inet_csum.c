@@ -13,14 +13,155 @@
  */
 
 #include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(__SSE2__) && (UINT_MAX > 0xffff)
+#include <emmintrin.h>
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#if UINT_MAX > 0xffff
+/* 32 bit platforms: add 32 bit words, the carries collect in the upper half */
+typedef uint64_t _acc_t;
+#define WORD_WISE   (1)
+#else
+/* 8 and 16 bit platforms: add 16 bit words. At most 0x7fff * 0xffff */
+typedef uint32_t _acc_t;
+#define WORD_WISE   (0)
+#endif
+
+/* the buffer is accessed through these to not break strict aliasing */
+typedef uint16_t __attribute__((may_alias)) _u16_alias_t;
+typedef uint32_t __attribute__((may_alias)) _u32_alias_t;
+
+/* folds a partial sum to 16 bits with end-around carry */
+static inline uint16_t _fold(_acc_t csum)
+{
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+#if defined(__SSE2__) && (UINT_MAX > 0xffff)
+/* adds 16-bit words of 16 byte blocks into four 32 bit lanes. Each lane takes
+ * at most 2 * 0xffff per block, so they do not overflow for len < 2^20 */
+static uint64_t _sum_sse2(const uint8_t **buf, uint16_t *len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint32_t lanes[4];
+
+    for (; *len >= 16; *buf += 16, *len -= 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *)*buf);
+
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(block, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(block, zero));
+    }
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+/* Sums up the 16-bit words of buf in host byte order, with an odd trailing
+ * byte padded as in network byte order. The carries of the additions are
+ * folded once in the end. */
+static uint16_t _sum(const uint8_t *buf, uint16_t len)
+{
+    _acc_t csum = 0;
+    bool odd = (uintptr_t)buf & 1;
+
+    if (odd) {
+        /* first byte is the upper half of a 16-bit word relative to the
+         * aligned buffer, so its position in host byte order is swapped */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        csum += (uint16_t)(*buf << 8);
+#else
+        csum += *buf;
+#endif
+        buf++;
+        len--;
+    }
+#if WORD_WISE
+    if ((len >= 2) && ((uintptr_t)buf & 2)) {
+        csum += *(const _u16_alias_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+#ifdef __SSE2__
+    csum += _sum_sse2(&buf, &len);
+#endif
+    for (; len >= 8; buf += 8, len -= 8) {
+        csum += ((const _u32_alias_t *)buf)[0];
+        csum += ((const _u32_alias_t *)buf)[1];
+    }
+    if (len >= 4) {
+        csum += *(const _u32_alias_t *)buf;
+        buf += 4;
+        len -= 4;
+    }
+#endif
+    for (; len >= 2; buf += 2, len -= 2) {
+        csum += *(const _u16_alias_t *)buf;
+    }
+    if (len) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        csum += *buf;
+#else
+        csum += (uint16_t)(*buf << 8);
+#endif
+    }
+    uint16_t res = _fold(csum);
+    return (odd) ? byteorder_swaps(res) : res;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+{
+    uint16_t csum;
+
+    DEBUG("inet_sum: sum = 0x%04" PRIx16 ", len = %" PRIu16, sum, len);
+#if ENABLE_DEBUG
+#ifdef MODULE_OD
+    DEBUG(", buf:\n");
+    od_hex_dump(buf, len, OD_WIDTH_DEFAULT);
+#else
+    DEBUG(", buf output only with od module\n");
+#endif
+#endif
+
+    if (len == 0) {
+        return sum;
+    }
+
+    /* The sum in host byte order is the byte swapped sum in network byte
+     * order (see RFC 1071, section 2 (B)). An odd accumulated length shifts
+     * all bytes to the other half of their 16-bit word, swapping the sum
+     * once more. */
+    csum = _sum(buf, len);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!(accum_len & 1)) {
+        csum = byteorder_swaps(csum);
+    }
+#else
+    if (accum_len & 1) {
+        csum = byteorder_swaps(csum);
+    }
+#endif
+    csum = _fold((_acc_t)sum + csum);
+
+    DEBUG("inet_sum: new sum = 0x%04" PRIx16 "\n", csum);
+
+    return csum;
+}
+
+uint16_t inet_csum_slice_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
 
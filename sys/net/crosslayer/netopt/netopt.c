@@ -120,6 +120,8 @@ static const char *_netopt_strmap[] = {
     [NETOPT_DEMOD_MARGIN]          = "NETOPT_DEMOD_MARGIN",
     [NETOPT_NUM_GATEWAYS]          = "NETOPT_NUM_GATEWAYS",
     [NETOPT_LINK_CHECK]            = "NETOPT_LINK_CHECK",
+    [NETOPT_RX_CSUM_OFFLOAD]       = "NETOPT_RX_CSUM_OFFLOAD",
+    [NETOPT_TX_CSUM_OFFLOAD]       = "NETOPT_TX_CSUM_OFFLOAD",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
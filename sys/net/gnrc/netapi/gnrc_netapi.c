@@ -81,6 +81,47 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+/* returns 0 on success or the status to release the packet with */
+static uint32_t _send_to(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                         gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    return status;
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        return EIO;
+    }
+    return 0;
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -92,45 +133,79 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
+            uint32_t status = _send_to(sendto, cmd, pkt);
+
             if (status != 0) {
                 gnrc_pktbuf_release_error(pkt, status);
             }
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    return numof;
+}
+
+/* only entries that opted in are able to handle a batch */
+static inline bool _rcv_batch(const gnrc_netreg_entry_t *entry)
+{
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+    /* callbacks are not called through a message queue, so there is nothing
+     * to save by handing them the batch */
+    if (entry->type == GNRC_NETREG_TYPE_CB) {
+        return false;
+    }
+#endif
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    return entry->rcv_batch;
 #else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
-            }
+    (void)entry;
+    return false;
 #endif
+}
+
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *batch)
+{
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof != 0) {
+        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+        unsigned pkts = gnrc_netapi_batch_numof(batch);
+
+        for (unsigned i = 0; i < pkts; i++) {
+            gnrc_pktbuf_hold(gnrc_netapi_batch_get(batch, i), numof - 1);
+        }
+
+        while (sendto) {
+            if (_rcv_batch(sendto)) {
+                uint32_t status;
+
+                gnrc_pktbuf_hold(batch, 1);
+                status = _send_to(sendto, GNRC_NETAPI_MSG_TYPE_RCV_BATCH,
+                                  batch);
+                if (status != 0) {
+                    for (unsigned i = 0; i < pkts; i++) {
+                        gnrc_pktbuf_release_error(gnrc_netapi_batch_get(batch, i),
+                                                  status);
+                    }
+                    gnrc_pktbuf_release(batch);
+                }
+            }
+            else {
+                for (unsigned i = 0; i < pkts; i++) {
+                    gnrc_pktsnip_t *pkt = gnrc_netapi_batch_get(batch, i);
+                    uint32_t status = _send_to(sendto, GNRC_NETAPI_MSG_TYPE_RCV,
+                                               pkt);
+
+                    if (status != 0) {
+                        gnrc_pktbuf_release_error(pkt, status);
+                    }
+                }
+            }
             sendto = gnrc_netreg_getnext(sendto);
         }
+        /* every receiver of the batch holds its own reference */
+        gnrc_pktbuf_release(batch);
     }
 
     return numof;
@@ -15,6 +15,8 @@
  * @author  Oliver Hahm <oliver.hahm@inria.fr>
  */
 
+#include <assert.h>
+#include <errno.h>
 #include <string.h>
 #include <kernel_defines.h>
 
@@ -23,6 +25,10 @@
 #include "net/ethernet.h"
 #include "net/ipv6.h"
 #include "net/gnrc.h"
+#include "net/protnum.h"
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+#include "net/sixlowpan.h"
+#endif
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
@@ -31,6 +37,7 @@
 #include "net/netstats.h"
 #endif
 #include "fmt.h"
+#include "irq.h"
 #include "log.h"
 #include "sched.h"
 #include "xtimer.h"
@@ -55,6 +62,7 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
 int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
                       char priority, const char *name, netdev_t *netdev,
@@ -1219,6 +1227,31 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     }
 }
 
+static bool _dev_has_opt(netdev_t *dev, netopt_t opt)
+{
+    netopt_enable_t enable = NETOPT_DISABLE;
+
+    return (dev->driver->get(dev, opt, &enable, sizeof(enable)) ==
+            sizeof(enable)) && (enable == NETOPT_ENABLE);
+}
+
+static void _init_csum_offload_from_dev(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+
+    /* 6LoWPAN rewrites the transport headers, so a checksum checked or
+     * inserted by the device would not cover what the stack sees */
+    if (gnrc_netif_is_6lo(netif)) {
+        return;
+    }
+    if (_dev_has_opt(dev, NETOPT_RX_CSUM_OFFLOAD)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD;
+    }
+    if (_dev_has_opt(dev, NETOPT_TX_CSUM_OFFLOAD)) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+}
+
 static void _init_from_device(gnrc_netif_t *netif)
 {
     int res;
@@ -1231,6 +1264,7 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+    _init_csum_offload_from_dev(netif);
 }
 
 static void _configure_netdev(netdev_t *dev)
@@ -1372,7 +1406,96 @@ void gnrc_netif_default_init(gnrc_netif_t *netif)
 #endif
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static_assert(CONFIG_GNRC_NETIF_RX_BATCH_SIZE <= UINT8_MAX,
+              "CONFIG_GNRC_NETIF_RX_BATCH_SIZE must fit into rx_batch_numof");
+
+/**
+ * @brief   Pass all collected packets on to the upper layer
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ */
+static void _rx_batch_flush(gnrc_netif_t *netif)
+{
+    unsigned numof = netif->rx_batch_numof;
+    gnrc_pktsnip_t *batch = NULL;
+    gnrc_nettype_t type;
+
+    if (numof == 0) {
+        return;
+    }
+    netif->rx_batch_numof = 0;
+    if (numof > 1) {
+        batch = gnrc_pktbuf_add(NULL, netif->rx_batch,
+                                numof * sizeof(gnrc_pktsnip_t *),
+                                GNRC_NETTYPE_UNDEF);
+    }
+    if (batch == NULL) {
+        /* a single packet or no space left for the batch */
+        for (unsigned i = 0; i < numof; i++) {
+            _pass_on_packet(netif, netif->rx_batch[i]);
+        }
+        return;
+    }
+    type = netif->rx_batch[0]->type;
+    DEBUG("gnrc_netif: passing on %u packets of type %i\n", numof, type);
+    /* throw away packets if no one is interested */
+    if (!gnrc_netapi_dispatch_receive_batch(type, GNRC_NETREG_DEMUX_CTX_ALL,
+                                            batch)) {
+        DEBUG("gnrc_netif: unable to forward packets of type %i\n", type);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(netif->rx_batch[i]);
+        }
+        gnrc_pktbuf_release(batch);
+        return;
+    }
+#ifdef MODULE_NETSTATS_L2
+    netif->stats.rx_dispatch_count++;
+#endif
+}
+
+/**
+ * @brief   Collect a received packet to pass it on with the next batch
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[in]   pkt     the received packet
+ */
+static void _rx_batch_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    /* the receivers of a batch are chosen by the type of its packets */
+    if ((netif->rx_batch_numof > 0) &&
+        (netif->rx_batch[0]->type != pkt->type)) {
+        _rx_batch_flush(netif);
+    }
+    netif->rx_batch[netif->rx_batch_numof++] = pkt;
+    if (netif->rx_batch_numof == CONFIG_GNRC_NETIF_RX_BATCH_SIZE) {
+        _rx_batch_flush(netif);
+    }
+}
+#endif /* MODULE_GNRC_NETIF_RX_BATCH */
+
 #if IS_USED(MODULE_GNRC_NETIF_EVENTS)
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+/**
+ * @brief   Take the ISR event from the event queue
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if the ISR event was posted again
+ */
+static bool _take_event_isr(gnrc_netif_t *netif)
+{
+    unsigned state = irq_disable();
+    bool posted = (netif->event_isr.list_node.next != NULL);
+
+    if (posted) {
+        event_cancel(&netif->evq, &netif->event_isr);
+    }
+    irq_restore(state);
+    return posted;
+}
+#endif /* MODULE_GNRC_NETIF_RX_BATCH */
+
 /**
  * @brief   Call the ISR handler from an event
  *
@@ -1382,6 +1505,15 @@ static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
     netif->dev->driver->isr(netif->dev);
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    /* handle interrupts that occurred meanwhile right away, so the packets
+     * received are passed on together */
+    for (unsigned i = 1; (i < CONFIG_GNRC_NETIF_RX_BATCH_SIZE) &&
+                         _take_event_isr(netif); i++) {
+        netif->dev->driver->isr(netif->dev);
+    }
+    _rx_batch_flush(netif);
+#endif
 }
 #endif
 
@@ -1412,6 +1544,58 @@ static inline event_queue_t *_get_evq(gnrc_netif_t *netif)
 #endif
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+/**
+ * @brief   Handle the interrupts that queued up in the message queue
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[out]  msg     pointer to message buffer to write a received message
+ *                      to, that is not an interrupt
+ *
+ * @return  true, if @p msg contains a new message
+ */
+static bool _rx_batch_isr_msgs(gnrc_netif_t *netif, msg_t *msg)
+{
+    bool received = false;
+
+    for (unsigned i = 1; i < CONFIG_GNRC_NETIF_RX_BATCH_SIZE; i++) {
+        if (msg_try_receive(msg) < 1) {
+            break;
+        }
+        if (msg->type != NETDEV_MSG_TYPE_EVENT) {
+            received = true;
+            break;
+        }
+        netif->dev->driver->isr(netif->dev);
+    }
+    return received;
+}
+#endif /* MODULE_GNRC_NETIF_RX_BATCH */
+
+/**
+ * @brief   Process all pending events
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ */
+static void _process_events(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_NETIF_EVENTS)
+    DEBUG("gnrc_netif: handling events\n");
+    event_t *evp;
+    /* We can not use event_loop() or event_wait() because then we would not
+     * wake up when a message arrives */
+    event_queue_t *evq = _get_evq(netif);
+    while ((evp = event_get(evq))) {
+        DEBUG("gnrc_netif: event %p\n", (void *)evp);
+        if (evp->handler) {
+            evp->handler(evp);
+        }
+    }
+#else
+    (void)netif;
+#endif
+}
+
 /**
  * @brief   Process any pending events and wait for IPC messages
  *
@@ -1431,17 +1615,7 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
 
             /* First drain the queues before blocking the thread */
             /* Events will be handled before messages */
-            DEBUG("gnrc_netif: handling events\n");
-            event_t *evp;
-            /* We can not use event_loop() or event_wait() because then we would not
-             * wake up when a message arrives */
-            event_queue_t *evq = _get_evq(netif);
-            while ((evp = event_get(evq))) {
-                DEBUG("gnrc_netif: event %p\n", (void *)evp);
-                if (evp->handler) {
-                    evp->handler(evp);
-                }
-            }
+            _process_events(netif);
             /* non-blocking msg check */
             int msg_waiting = msg_try_receive(msg);
             if (msg_waiting > 0) {
@@ -1459,6 +1633,253 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
 }
 
+static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    int res = netif->ops->send(netif, pkt);
+
+    if (res < 0) {
+        DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
+              (void *)pkt, res);
+    }
+#ifdef MODULE_NETSTATS_L2
+    else {
+        netif->stats.tx_bytes += res;
+    }
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+/**
+ * @brief   DSCP of class selector 6 (network control), see RFC 2474
+ */
+#define _TX_SCHED_DSCP_CS6      (48U)
+
+/**
+ * @brief   Queue priority of best effort traffic
+ *
+ * The priority queue sends lower values first, so the DSCP is inverted.
+ */
+#define _TX_SCHED_PRIO_BE       (63U)
+
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+/**
+ * @brief   Get DSCP and next header of a LOWPAN_IPHC header
+ *
+ * @param[in]   iphc    the LOWPAN_IPHC header
+ * @param[in]   size    length of @p iphc
+ * @param[out]  nh      inline next header, unchanged if compressed
+ *
+ * @return  the DSCP, 0 if elided
+ */
+static unsigned _tx_sched_iphc_dscp(const uint8_t *iphc, size_t size,
+                                    unsigned *nh)
+{
+    /* length of the inline traffic class and flow label fields by TF */
+    static const uint8_t tf_len[] = { 4, 3, 1, 0 };
+    unsigned tf = (iphc[0] & SIXLOWPAN_IPHC1_TF) >> 3;
+    size_t pos = SIXLOWPAN_IPHC_HDR_LEN;
+    unsigned dscp = 0;
+
+    if (iphc[1] & SIXLOWPAN_IPHC2_CID_EXT) {
+        pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    if ((pos + tf_len[tf] + 1) > size) {
+        return 0;
+    }
+    if ((tf == 0) || (tf == 2)) {
+        /* ECN and DSCP are swapped compared to the IPv6 traffic class */
+        dscp = iphc[pos] & 0x3f;
+    }
+    pos += tf_len[tf];
+    if (!(iphc[0] & SIXLOWPAN_IPHC1_NH)) {
+        *nh = iphc[pos];
+    }
+    return dscp;
+}
+#endif
+
+/**
+ * @brief   Get the queue priority of a packet from its traffic class
+ *
+ * @param[in]   pkt     packet to send
+ *
+ * @return  priority for gnrc_netif_t::tx_queue
+ */
+static uint32_t _tx_sched_prio(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snip = pkt;
+    unsigned dscp = 0;
+    unsigned nh = PROTNUM_RESERVED;
+
+    if ((snip->type == GNRC_NETTYPE_NETIF) && (snip->next != NULL)) {
+        snip = snip->next;
+    }
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    if ((snip->type == GNRC_NETTYPE_IPV6) &&
+        (snip->size >= sizeof(ipv6_hdr_t))) {
+        ipv6_hdr_t *hdr = snip->data;
+
+        dscp = ipv6_hdr_get_tc_dscp(hdr);
+        nh = hdr->nh;
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+    if ((snip->type == GNRC_NETTYPE_SIXLOWPAN) &&
+        (snip->size > SIXLOWPAN_IPHC_HDR_LEN) &&
+        sixlowpan_iphc_is(snip->data)) {
+        dscp = _tx_sched_iphc_dscp(snip->data, snip->size, &nh);
+    }
+#endif
+    /* NDP and RPL do not set a traffic class */
+    if ((dscp == 0) && (nh == PROTNUM_ICMPV6)) {
+        dscp = _TX_SCHED_DSCP_CS6;
+    }
+    return _TX_SCHED_PRIO_BE - dscp;
+}
+
+/**
+ * @brief   Put a packet into the send queue
+ *
+ * @pre The send queue is not full
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[in]   pkt     packet to send
+ */
+static void _tx_sched_push(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_TX_QUEUE_SIZE; i++) {
+        gnrc_priority_pktqueue_node_t *node = &netif->tx_queue_nodes[i];
+
+        if (node->pkt == NULL) {
+            gnrc_priority_pktqueue_node_init(node, _tx_sched_prio(pkt), pkt);
+            gnrc_priority_pktqueue_push(&netif->tx_queue, node);
+            return;
+        }
+    }
+    assert(false);
+}
+
+/**
+ * @brief   Check if the send queue has no free node left
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if the send queue is full
+ */
+static bool _tx_sched_full(const gnrc_netif_t *netif)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_TX_QUEUE_SIZE; i++) {
+        if (netif->tx_queue_nodes[i].pkt == NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Send the packet with the highest priority
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if a packet was sent
+ */
+static bool _tx_sched_send_next(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkt = gnrc_priority_pktqueue_pop(&netif->tx_queue);
+
+    if (pkt == NULL) {
+        return false;
+    }
+    _send(netif, pkt);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    netif->tx_paced = true;
+    netif->tx_pacing_msg.type = GNRC_NETIF_TX_SCHED_MSG_TYPE;
+    /* tells apart a message of a timer that was replaced */
+    netif->tx_pacing_msg.content.value++;
+    xtimer_set_msg(&netif->tx_pacing_timer,
+                   CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US,
+                   &netif->tx_pacing_msg, netif->pid);
+#endif
+    return true;
+}
+
+/**
+ * @brief   Queue a send request
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[in]   pkt     packet to send
+ */
+static void _tx_sched_request(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    if (_tx_sched_full(netif)) {
+        /* make room by sending the best packet instead of dropping one, like
+         * without the scheduler */
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+        if (netif->tx_paced) {
+            /* there is no room to hold pkt until the pacing timer fires, so
+             * fall back to blocking (see CONFIG_GNRC_NETIF_TX_QUEUE_SIZE) */
+            xtimer_remove(&netif->tx_pacing_timer);
+            xtimer_usleep(CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+            netif->tx_paced = false;
+        }
+#endif
+        _tx_sched_send_next(netif);
+    }
+    _tx_sched_push(netif, pkt);
+}
+
+/**
+ * @brief   Move the send requests that queued up into the send queue
+ *
+ * Stops when the send queue is full, the remaining requests wait in the
+ * message queue until a packet was sent.
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[out]  msg     pointer to message buffer to write a received message
+ *                      to, that is not a send request
+ *
+ * @return  true, if @p msg contains a new message
+ */
+static bool _tx_sched_collect(gnrc_netif_t *netif, msg_t *msg)
+{
+    while (!_tx_sched_full(netif) && (msg_try_receive(msg) > 0)) {
+        if (msg->type != GNRC_NETAPI_MSG_TYPE_SND) {
+            return true;
+        }
+        _tx_sched_request(netif, msg->content.ptr);
+    }
+    return false;
+}
+
+/**
+ * @brief   Send queued packets until a message arrives
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ * @param[out]  msg     pointer to message buffer to write a received message
+ *                      to, that is not a send request
+ *
+ * @return  true, if @p msg contains a new message
+ */
+static bool _tx_sched_run(gnrc_netif_t *netif, msg_t *msg)
+{
+    while (1) {
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+        if (netif->tx_paced) {
+            return false;
+        }
+#endif
+        if (!_tx_sched_send_next(netif)) {
+            return false;
+        }
+        /* do not let a burst of packets delay reception */
+        _process_events(netif);
+        if (_tx_sched_collect(netif, msg)) {
+            return true;
+        }
+    }
+}
+#endif /* MODULE_GNRC_NETIF_TX_SCHED */
+
 static void *_gnrc_netif_thread(void *args)
 {
     gnrc_netapi_opt_t *opt;
@@ -1467,6 +1888,9 @@ static void *_gnrc_netif_thread(void *args)
     int res;
     msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
     msg_t msg_queue[GNRC_NETIF_MSG_QUEUE_SIZE];
+    msg_t msg;
+    /* set, if msg was already received while handling the previous message */
+    bool msg_pending = false;
 
     DEBUG("gnrc_netif: starting thread %i\n", sched_active_pid);
     netif = args;
@@ -1507,15 +1931,22 @@ static void *_gnrc_netif_thread(void *args)
 #endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
-#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+    gnrc_priority_pktqueue_init(&netif->tx_queue);
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_TX_QUEUE_SIZE; i++) {
+        gnrc_priority_pktqueue_node_init(&netif->tx_queue_nodes[i], 0, NULL);
+    }
+#elif (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
     xtimer_ticks32_t last_wakeup = xtimer_now();
 #endif
 
     while (1) {
-        msg_t msg;
         /* msg will be filled by _process_events_await_msg.
          * The function will not return until a message has been received. */
-        _process_events_await_msg(netif, &msg);
+        if (!msg_pending) {
+            _process_events_await_msg(netif, &msg);
+        }
+        msg_pending = false;
 
         /* dispatch netdev, MAC and gnrc_netapi messages */
         DEBUG("gnrc_netif: message %u\n", (unsigned)msg.type);
@@ -1523,19 +1954,17 @@ static void *_gnrc_netif_thread(void *args)
             case NETDEV_MSG_TYPE_EVENT:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
                 dev->driver->isr(dev);
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+                msg_pending = _rx_batch_isr_msgs(netif, &msg);
+#endif
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                res = netif->ops->send(netif, msg.content.ptr);
-                if (res < 0) {
-                    DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
-                          msg.content.ptr, res);
-                }
-#ifdef MODULE_NETSTATS_L2
-                else {
-                    netif->stats.tx_bytes += res;
-                }
-#endif
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+                _tx_sched_request(netif, msg.content.ptr);
+                msg_pending = _tx_sched_collect(netif, &msg);
+#else /* MODULE_GNRC_NETIF_TX_SCHED */
+                _send(netif, msg.content.ptr);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
                 xtimer_periodic_wakeup(
                         &last_wakeup,
@@ -1545,7 +1974,17 @@ static void *_gnrc_netif_thread(void *args)
                  * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
                 last_wakeup = xtimer_now();
 #endif
+#endif /* MODULE_GNRC_NETIF_TX_SCHED */
+                break;
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED) && \
+    (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+            case GNRC_NETIF_TX_SCHED_MSG_TYPE:
+                DEBUG("gnrc_netif: GNRC_NETIF_TX_SCHED_MSG_TYPE received\n");
+                if (msg.content.value == netif->tx_pacing_msg.content.value) {
+                    netif->tx_paced = false;
+                }
                 break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
@@ -1588,12 +2027,22 @@ static void *_gnrc_netif_thread(void *args)
                 }
                 break;
         }
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+        /* pass on what was received while handling the message */
+        _rx_batch_flush(netif);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_TX_SCHED)
+        /* send when there is nothing else to do */
+        if (!msg_pending) {
+            msg_pending = _tx_sched_run(netif, &msg);
+        }
+#endif
     }
     /* never reached */
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
@@ -1602,6 +2051,43 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
+#ifdef MODULE_NETSTATS_L2
+    netif->stats.rx_dispatch_count++;
+#else
+    (void)netif;
+#endif
+}
+
+/* the device only checks UDP and TCP directly following the IPv6 header,
+ * fragments and packets with extension headers are left to the stack */
+static bool _rx_csum_checked(gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    if ((pkt->type == GNRC_NETTYPE_IPV6) &&
+        (pkt->size >= sizeof(ipv6_hdr_t)) && ipv6_hdr_is(pkt->data)) {
+        uint8_t nh = ((ipv6_hdr_t *)pkt->data)->nh;
+
+        return (nh == PROTNUM_UDP) || (nh == PROTNUM_TCP);
+    }
+#else
+    (void)pkt;
+#endif
+    return false;
+}
+
+static void _mark_rx_csum_offload(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    if ((netif->flags & GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD) &&
+        _rx_csum_checked(pkt)) {
+        gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt,
+                                                              GNRC_NETTYPE_NETIF);
+
+        if (netif_snip != NULL) {
+            gnrc_netif_hdr_t *hdr = netif_snip->data;
+
+            hdr->flags |= GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+        }
+    }
 }
 
 static void _event_cb(netdev_t *dev, netdev_event_t event)
@@ -1628,7 +2114,12 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
             case NETDEV_EVENT_RX_COMPLETE:
                 pkt = netif->ops->recv(netif);
                 if (pkt) {
-                    _pass_on_packet(pkt);
+                    _mark_rx_csum_offload(netif, pkt);
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+                    _rx_batch_add(netif, pkt);
+#else
+                    _pass_on_packet(netif, pkt);
+#endif
                 }
                 break;
 #ifdef MODULE_NETSTATS_L2
@@ -51,6 +51,27 @@ uint8_t gnrc_netif_hdr_get_flag(gnrc_pktsnip_t* pkt)
     return 0U;
 }
 
+bool gnrc_netif_hdr_rx_csum_offloaded(gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+
+    pkt = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (pkt && pkt->data) {
+        gnrc_netif_hdr_t *netif_hdr = pkt->data;
+        if (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_CSUM_VALID) {
+#ifdef MODULE_NETSTATS_IPV6
+            gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
+
+            if (netif != NULL) {
+                netif->ipv6.stats.rx_csum_offload_count++;
+            }
+#endif
+            return true;
+        }
+    }
+    return false;
+}
+
 int gnrc_netif_hdr_get_dstaddr(gnrc_pktsnip_t* pkt, uint8_t** pointer_to_addr)
 {
     assert(pkt != NULL);
@@ -13,6 +13,7 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "assert.h"
@@ -28,13 +29,55 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#ifdef MODULE_GNRC_NETREG_HASH
+#define _BUCKETS_NUMOF      (1U << CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP)
+
+static_assert(CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP <= 16,
+              "CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP must not exceed 16");
+
+/* The registry as hash table by gnrc_nettype_t and demux context */
+static gnrc_netreg_entry_t *netreg[_BUCKETS_NUMOF];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    /* multiplicative hashing, so consecutive ports spread over all buckets */
+    uint32_t hash = (demux_ctx ^ ((uint32_t)type << 24)) * 2654435761U;
+
+    return &netreg[(hash >> 16) & (_BUCKETS_NUMOF - 1)];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    return (entry->demux_ctx == demux_ctx) && (entry->nettype == type);
+}
+#else
+#define _BUCKETS_NUMOF      (GNRC_NETTYPE_NUMOF)
+
 /* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+static gnrc_netreg_entry_t *netreg[_BUCKETS_NUMOF];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* all entries in a list are of the same type */
+    (void)type;
+    return (entry->demux_ctx == demux_ctx);
+}
+#endif
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -59,7 +102,10 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+#ifdef MODULE_GNRC_NETREG_HASH
+    entry->nettype = type;
+#endif
+    LL_PREPEND(*_bucket(type, entry->demux_ctx), entry);
 
     return 0;
 }
@@ -70,7 +116,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
 }
 
 /**
@@ -92,8 +138,10 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
-        LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
+        res = (from) ? from->next : *_bucket(type, demux_ctx);
+        while (res && !_matches(res, type, demux_ctx)) {
+            res = res->next;
+        }
     }
 
     return res;
@@ -117,7 +165,12 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
 
 gnrc_netreg_entry_t *gnrc_netreg_getnext(gnrc_netreg_entry_t *entry)
 {
+#ifdef MODULE_GNRC_NETREG_HASH
+    return (entry ? _netreg_lookup(entry, entry->nettype, entry->demux_ctx)
+                  : NULL);
+#else
     return (entry ? _netreg_lookup(entry, 0, entry->demux_ctx) : NULL);
+#endif
 }
 
 int gnrc_netreg_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
@@ -184,7 +184,11 @@ static void *_event_loop(void *args)
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
     gnrc_ipv6_ext_frag_init();
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
-    /* register interest in all IPv6 packets */
+    /* register interest in all IPv6 packets, received ones may come in
+     * batches */
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    me_reg.rcv_batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
 
     /* preinitialize ACK */
@@ -201,6 +205,15 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -307,8 +320,9 @@ static gnrc_pktsnip_t *_create_netif_hdr(uint8_t *dst_l2addr,
     }
     hdr = netif_hdr->data;
     /* previous netif header might have been allocated by some higher layer
-     * to provide some flags (provided to us via netif_flags). */
-    hdr->flags = flags;
+     * to provide some flags (provided to us via netif_flags). The checksum
+     * flag was meant for us only. */
+    hdr->flags = flags & ~GNRC_NETIF_HDR_FLAGS_CSUM_PRESET;
 
     /* add netif_hdr to front of the pkt list */
     LL_PREPEND(pkt, netif_hdr);
@@ -326,7 +340,46 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+static inline unsigned _path_mtu(gnrc_netif_t *netif)
+{
+    /* TODO: get path MTU when PMTU discovery is implemented */
+    return netif->ipv6.mtu;
+}
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+
+static bool _tx_csum_offloaded(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                               gnrc_pktsnip_t *payload)
+{
+    bool transport = false;
+
+#if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+    transport |= (payload->type == GNRC_NETTYPE_TCP);
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+    transport |= (payload->type == GNRC_NETTYPE_UDP);
+#endif
+    /* the device only finds the transport header directly after the IPv6
+     * header */
+    if (!transport || (ipv6->next != payload) || (netif == NULL) ||
+        !(netif->flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD)) {
+        return false;
+    }
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+    /* the device can only insert the checksum if the packet is not
+     * fragmented, see _fragment_pkt_if_needed() */
+    if (gnrc_pkt_len(ipv6) > _path_mtu(netif)) {
+        return false;
+    }
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+#ifdef MODULE_NETSTATS_IPV6
+    netif->ipv6.stats.tx_csum_offload_count++;
+#endif
+    return true;
+}
+
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          bool to_iface, bool csum_preset)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -426,6 +479,20 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    if (to_iface && _tx_csum_offloaded(netif, ipv6, payload)) {
+        DEBUG("ipv6: checksum for upper header is inserted by device.\n");
+        return 0;
+    }
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+    if (csum_preset && (payload->type == GNRC_NETTYPE_UDP)) {
+        /* already calculated by the sender, e.g. by sock from its cached
+         * pseudo-header sum */
+        DEBUG("ipv6: keep preset checksum for upper header.\n");
+        return 0;
+    }
+#else
+    (void)csum_preset;
+#endif
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -439,9 +506,12 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, bool to_iface,
+                                uint8_t netif_hdr_flags)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr &&
+        (_fill_ipv6_hdr(netif, pkt, to_iface,
+                        netif_hdr_flags & GNRC_NETIF_HDR_FLAGS_CSUM_PRESET) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -455,8 +525,7 @@ static bool _fragment_pkt_if_needed(gnrc_pktsnip_t *pkt,
                                     bool from_me)
 {
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
-    /* TODO: get path MTU when PMTU discovery is implemented */
-    unsigned path_mtu = netif->ipv6.mtu;
+    unsigned path_mtu = _path_mtu(netif);
 
     if (from_me && (gnrc_pkt_len(pkt->next) > path_mtu)) {
         gnrc_netif_hdr_t *hdr = pkt->data;
@@ -498,7 +567,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true, netif_hdr_flags)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -580,7 +649,9 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, true,
+                                       netif_hdr_flags &
+                                       GNRC_NETIF_HDR_FLAGS_CSUM_PRESET) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -594,7 +665,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true, netif_hdr_flags)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -609,16 +680,16 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true, netif_hdr_flags)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
 }
 
 static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
-                          gnrc_netif_t *netif)
+                          gnrc_netif_t *netif, uint8_t netif_hdr_flags)
 {
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr) ||
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false, netif_hdr_flags) ||
         /* no netif header so we just merge the whole packet. */
         (gnrc_pktbuf_merge(pkt) != 0)) {
         DEBUG("ipv6: error looping packet to sender.\n");
@@ -701,7 +772,7 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
         if (ipv6_addr_is_loopback(&ipv6_hdr->dst) ||    /* dst is loopback address */
             /* or dst registered to a local interface */
             (tmp_netif != NULL)) {
-            _send_to_self(pkt, prep_hdr, tmp_netif);
+            _send_to_self(pkt, prep_hdr, tmp_netif, netif_hdr_flags);
         }
         else {
             _send_unicast(pkt, prep_hdr, netif, ipv6_hdr, netif_hdr_flags);
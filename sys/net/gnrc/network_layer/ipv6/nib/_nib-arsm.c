@@ -79,8 +79,8 @@ void _snd_uc_ns(_nib_onl_entry_t *nbr, bool reset)
     (void)reset;
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
     _snd_ns(&nbr->ipv6, netif, NULL, &nbr->ipv6);
-    _evtimer_add(nbr, GNRC_IPV6_NIB_SND_UC_NS, &nbr->nud_timeout,
-                 netif->ipv6.retrans_time);
+    _evtimer_add_until(nbr, GNRC_IPV6_NIB_SND_UC_NS, &nbr->nud_timeout,
+                       &nbr->nud_timeout_until, netif->ipv6.retrans_time);
     gnrc_netif_release(netif);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     nbr->ns_sent++;
@@ -107,7 +107,7 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
          * see https://tools.ietf.org/html/rfc6775#section-6.3 */
         !_rtr_sol_on_6lr(netif, icmpv6)) {
         DEBUG("nib: L2 address differs. Setting STALE\n");
-        evtimer_del(&_nib_evtimer, &nce->nud_timeout.event);
+        _evtimer_cancel(&nce->nud_timeout);
         _set_nud_state(netif, nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
@@ -275,7 +275,8 @@ void _probe_nbr(_nib_onl_entry_t *nbr, bool reset)
         case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_INCOMPLETE:
         case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE: {
                 gnrc_netif_t *netif = gnrc_netif_get_by_pid(_nib_onl_get_if(nbr));
-                uint32_t next_ns = _evtimer_lookup(nbr,
+                uint32_t next_ns = _evtimer_lookup(&nbr->nud_timeout,
+                                                   nbr->nud_timeout_until,
                                                    GNRC_IPV6_NIB_SND_MC_NS);
 
                 assert(netif != NULL);
@@ -300,8 +301,9 @@ void _probe_nbr(_nib_onl_entry_t *nbr, bool reset)
                     DEBUG("(retrans. timer = %ums)\n", (unsigned)retrans_time);
                     ipv6_addr_set_solicited_nodes(&sol_nodes, &nbr->ipv6);
                     _snd_ns(&nbr->ipv6, netif, NULL, &sol_nodes);
-                    _evtimer_add(nbr, GNRC_IPV6_NIB_SND_MC_NS, &nbr->nud_timeout,
-                                 retrans_time);
+                    _evtimer_add_until(nbr, GNRC_IPV6_NIB_SND_MC_NS,
+                                       &nbr->nud_timeout,
+                                       &nbr->nud_timeout_until, retrans_time);
                     if (nbr->ns_sent < (NDP_MAX_NS_NUMOF + 2)) {
                         /* cap ns_sent at NDP_MAX_NS_NUMOF to prevent backoff
                          * overflow */
@@ -364,7 +366,7 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
             DEBUG("nib: Set %s%%%u to STALE\n",
                   ipv6_addr_to_str(addr_str, &nce->ipv6, sizeof(addr_str)),
                   (unsigned)netif->pid);
-            evtimer_del(&_nib_evtimer, &nce->nud_timeout.event);
+            _evtimer_cancel(&nce->nud_timeout);
             _set_nud_state(netif, nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
         }
         if (_oflag_set((ndp_nbr_adv_t *)icmpv6) ||
@@ -394,7 +396,7 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
             !_sflag_set((ndp_nbr_adv_t *)icmpv6) &&
             (_get_nud_state(nce) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) &&
             _tl2ao_changes_nce(nce, tl2ao, netif, l2addr_len)) {
-            evtimer_del(&_nib_evtimer, &nce->nud_timeout.event);
+            _evtimer_cancel(&nce->nud_timeout);
             _set_nud_state(netif, nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
         }
     }
@@ -424,8 +426,8 @@ void _set_reachable(gnrc_netif_t *netif, _nib_onl_entry_t *nce)
           ipv6_addr_to_str(addr_str, &nce->ipv6, sizeof(addr_str)),
           netif->pid, (unsigned)netif->ipv6.reach_time);
     _set_nud_state(netif, nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
-    _evtimer_add(nce, GNRC_IPV6_NIB_REACH_TIMEOUT, &nce->nud_timeout,
-                 netif->ipv6.reach_time);
+    _evtimer_add_until(nce, GNRC_IPV6_NIB_REACH_TIMEOUT, &nce->nud_timeout,
+                       &nce->nud_timeout_until, netif->ipv6.reach_time);
 }
 
 void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
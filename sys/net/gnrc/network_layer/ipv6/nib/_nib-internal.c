@@ -27,6 +27,8 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-offl-trie.h"
+#include "_nib-onl-hash.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG    (0)
@@ -53,6 +55,8 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+static void _evtimer_handler(evtimer_event_t *event);
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -65,7 +69,13 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
-    evtimer_init_msg(&_nib_evtimer);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    _nib_offl_trie_init();
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_hash_init(_nodes, CONFIG_GNRC_IPV6_NIB_NUMOF);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+    evtimer_init((evtimer_t *)&_nib_evtimer, _evtimer_handler);
     /* TODO: load ABR information from persistent memory */
 }
 
@@ -86,6 +96,40 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+static _nib_onl_entry_t *_onl_hash_match(const ipv6_addr_t *addr,
+                                         unsigned iface)
+{
+    _nib_onl_entry_t *node;
+
+    if (addr == NULL) {
+        /* any entry on the interface matches */
+        node = NULL;
+        while ((node = _nib_onl_iter(node)) != NULL) {
+            if (_nib_onl_get_if(node) == iface) {
+                return node;
+            }
+        }
+        return NULL;
+    }
+    for (node = _nib_onl_hash_first(addr); node != NULL;
+         node = node->hash_next) {
+        if ((_nib_onl_get_if(node) == iface) &&
+            ipv6_addr_equal(addr, &node->ipv6)) {
+            return node;
+        }
+    }
+    /* entries with unspecified address match any address */
+    for (node = _nib_onl_hash_first(&ipv6_addr_unspecified); node != NULL;
+         node = node->hash_next) {
+        if (_nib_onl_get_if(node) == iface) {
+            return node;
+        }
+    }
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -93,6 +137,14 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    if ((node = _onl_hash_match(addr, iface)) != NULL) {
+        DEBUG("  %p is an exact match\n", (void *)node);
+    }
+    else {
+        node = _nib_onl_hash_alloc();
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -107,6 +159,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
             node = tmp;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     if (node != NULL) {
         _override_node(addr, iface, node);
     }
@@ -125,6 +178,27 @@ static inline bool _is_gc(_nib_onl_entry_t *node)
             GNRC_IPV6_NIB_NC_INFO_AR_STATE_GC);
 }
 
+static inline bool _recently_used(_nib_onl_entry_t *node)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    bool res = node->recently_used;
+
+    node->recently_used = false;
+    return res;
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+    (void)node;
+    return false;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+}
+
+static inline bool _next_round(bool *spared)
+{
+    bool res = *spared;
+
+    *spared = false;
+    return res;
+}
+
 static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                                                      unsigned iface,
                                                      uint16_t cstate)
@@ -132,6 +206,7 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
     /* Use clist as FIFO for caching */
     _nib_onl_entry_t *first = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
     _nib_onl_entry_t *tmp = first, *res = NULL;
+    bool spared = false;
 
     DEBUG("nib: Searching for replaceable entries (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
@@ -139,7 +214,11 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
         return NULL;
     }
     do {
-        if (_is_gc(tmp)) {
+        if (_is_gc(tmp) && _recently_used(tmp)) {
+            /* give recently used entry a second chance */
+            spared = true;
+        }
+        else if (_is_gc(tmp)) {
             DEBUG("nib: Removing neighbor cache entry (addr = %s, "
                   "iface = %u) ",
                   ipv6_addr_to_str(addr_str, &tmp->ipv6,
@@ -164,7 +243,9 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
             /* no new entry created yet, get next entry in FIFO */
             tmp = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
         }
-    } while ((tmp != first) && (res == NULL));
+        /* go for another round if entries were spared, they are not marked
+         * as recently used anymore */
+    } while (((tmp != first) || _next_round(&spared)) && (res == NULL));
     if (res == NULL) {
         /* we did not find any removable entry => requeue current one */
         clist_rpush(&_next_removable, (clist_node_t *)tmp);
@@ -220,8 +301,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    for (_nib_onl_entry_t *node = _nib_onl_hash_first(addr); node != NULL;
+         node = node->hash_next) {
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 
         if ((node->mode != _EMPTY) &&
             /* either requested or current interface undefined or
@@ -230,6 +316,9 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
              (_nib_onl_get_if(node) == iface)) &&
             ipv6_addr_equal(&node->ipv6, addr)) {
             DEBUG("  Found %p\n", (void *)node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+            node->recently_used = true;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
             return node;
         }
     }
@@ -253,8 +342,8 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
     DEBUG("nib: set %s%%%u reachable (reachable time = %u)\n",
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node), (unsigned)netif->ipv6.reach_time);
-    _evtimer_add(node, GNRC_IPV6_NIB_REACH_TIMEOUT, &node->nud_timeout,
-                 netif->ipv6.reach_time);
+    _evtimer_add_until(node, GNRC_IPV6_NIB_REACH_TIMEOUT, &node->nud_timeout,
+                       &node->nud_timeout_until, netif->ipv6.reach_time);
 #else   /* CONFIG_GNRC_IPV6_NIB_ARSM */
     (void)node;
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
@@ -266,15 +355,15 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
-    evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
+    _evtimer_del(&node->snd_na);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
-    evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
+    _evtimer_del(&node->nud_timeout);
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
-    evtimer_del((evtimer_t *)&_nib_evtimer, &node->reply_rs.event);
+    _evtimer_del(&node->reply_rs);
 #endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LR)
-    evtimer_del((evtimer_t *)&_nib_evtimer, &node->addr_reg_timeout.event);
+    _evtimer_del(&node->addr_reg_timeout);
 #endif  /* CONFIG_GNRC_IPV6_NIB_6LR */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT)
     gnrc_pktqueue_t *tmp;
@@ -495,6 +584,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+                _nib_onl_hash_add(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -515,6 +607,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        _nib_offl_trie_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     }
     return dst;
 }
@@ -551,6 +646,17 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        for (ptr = _dsts; _in_dsts(ptr); ptr++) {
+            /* there is another dst with the same prefix => let it take over */
+            if ((dst != ptr) && (ptr->next_hop != NULL) &&
+                (dst->pfx_len == ptr->pfx_len) &&
+                ipv6_addr_equal(&dst->pfx, &ptr->pfx)) {
+                break;
+            }
+        }
+        _nib_offl_trie_remove(dst, _in_dsts(ptr) ? ptr : NULL);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -576,11 +682,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_offl_trie_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
-    DEBUG("nib: get match for destination %s from NIB\n",
-          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -601,6 +710,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -832,6 +942,9 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_hash_add(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -846,21 +959,31 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
     }
 }
 
-uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
+uint32_t _evtimer_lookup(const evtimer_msg_event_t *event, uint32_t until,
+                         uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
-    uint32_t offset = 0;
+    int32_t remaining;
 
-    DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
-    while (event != NULL) {
-        offset += event->event.offset;
-        if ((event->msg.type == type) &&
-            ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
-            return offset;
-        }
-        event = (evtimer_msg_event_t *)event->event.next;
+    DEBUG("nib: lookup event = %p, type = %04x\n", (void *)event, type);
+    if (event->msg.type != type) {
+        return UINT32_MAX;
+    }
+    remaining = (int32_t)(until - evtimer_now_msec());
+    /* event may be due but not fired yet */
+    return (remaining < 0) ? 0 : (uint32_t)remaining;
+}
+
+static void _evtimer_handler(evtimer_event_t *event)
+{
+    evtimer_msg_event_t *mevent = (evtimer_msg_event_t *)event;
+
+    /* events cancelled with _evtimer_cancel() are dropped */
+    if (mevent->msg.type != 0) {
+        _evtimer_msg_handler(event);
     }
-    return UINT32_MAX;
+    /* mark event as no longer queued for _evtimer_lookup() and _evtimer_add() */
+    mevent->msg.type = 0;
+    mevent->msg.sender_pid = KERNEL_PID_UNDEF;
 }
 
 /** @} */
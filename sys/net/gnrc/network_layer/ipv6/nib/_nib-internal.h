@@ -27,6 +27,7 @@
 
 #include "bitfield.h"
 #include "evtimer_msg.h"
+#include "irq.h"
 #include "kernel_types.h"
 #include "mutex.h"
 #include "net/eui64.h"
@@ -92,6 +93,20 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry in the same hash bucket or list of free entries
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+     */
+    struct _nib_onl_entry *hash_next;
+    /**
+     * @brief   Link pointing to this entry, NULL if not linked
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+     */
+    struct _nib_onl_entry **hash_pprev;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -138,6 +153,11 @@ typedef struct _nib_onl_entry {
      *          neighbor solicitations.
      */
     evtimer_msg_event_t nud_timeout;
+    /**
+     * @brief   Time in milliseconds (see evtimer_now_msec()) at which
+     *          _nib_onl_entry_t::nud_timeout fires
+     */
+    uint32_t nud_timeout_until;
     /**
      * @brief Event for @ref GNRC_IPV6_NIB_SND_NA
      */
@@ -179,6 +199,15 @@ typedef struct _nib_onl_entry {
      */
     uint8_t l2addr_len;
 #endif
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Entry was looked up since it was last considered for
+     *          replacement
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+     */
+    bool recently_used;
+#endif
 } _nib_onl_entry_t;
 
 /**
@@ -310,6 +339,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Clears an on-link entry and returns it to the free entries
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ *
+ * @param[in,out] node  An entry with _nib_onl_entry_t::mode == _EMPTY.
+ */
+void _nib_onl_hash_free(_nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -321,7 +361,11 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        _nib_onl_hash_free(node);
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         return true;
     }
     return false;
@@ -796,13 +840,73 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *ctx,
 /**
  * @brief   Looks up if an event is queued in the event timer
  *
- * @param[in] ctx   Context of the event. May be NULL for any event context.
+ * Events handled by @ref _nib_evtimer have their `msg.type` reset to 0 when
+ * they fire or are removed with _evtimer_del() or _evtimer_cancel(), so this
+ * is answered from the event itself without walking the timer's event list.
+ *
+ * @param[in] event Representation of the event.
+ * @param[in] until Time in milliseconds (see evtimer_now_msec()) the event was
+ *                  scheduled for, as recorded by _evtimer_add_until().
  * @param[in] type  [Type of the event](@ref net_gnrc_ipv6_nib_msg).
  *
  * @return  Milliseconds to the event, if event in queue.
  * @return  UINT32_MAX, event is not in queue.
  */
-uint32_t _evtimer_lookup(const void *ctx, uint16_t type);
+uint32_t _evtimer_lookup(const evtimer_msg_event_t *event, uint32_t until,
+                         uint16_t type);
+
+/**
+ * @brief   Checks if an event is still in the event timer's list
+ *
+ * This is also the case for events cancelled with _evtimer_cancel() that are
+ * not due yet. evtimer_add_msg() stores the target thread in `msg.sender_pid`,
+ * the handler of @ref _nib_evtimer resets it when the event leaves the list.
+ *
+ * @param[in] event Representation of the event.
+ *
+ * @return  true, if @p event is in the list of @ref _nib_evtimer.
+ */
+static inline bool _evtimer_listed(const evtimer_msg_event_t *event)
+{
+    return (event->msg.sender_pid != KERNEL_PID_UNDEF);
+}
+
+/**
+ * @brief   Removes an event from the event timer
+ *
+ * Use this before the memory of the event is cleared or reused.
+ *
+ * @param[in,out] event Representation of the event.
+ */
+static inline void _evtimer_del(evtimer_msg_event_t *event)
+{
+    /* the event timer handler updates the event in ISR context */
+    unsigned state = irq_disable();
+
+    if (_evtimer_listed(event)) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), (evtimer_event_t *)event);
+        event->msg.sender_pid = KERNEL_PID_UNDEF;
+    }
+    event->msg.type = 0;
+    irq_restore(state);
+}
+
+/**
+ * @brief   Cancels an event without removing it from the event timer
+ *
+ * Other than _evtimer_del() this does not walk the list of the event timer.
+ * The event stays in the list until it is due and is dropped then, so its
+ * memory must stay valid: use _evtimer_del() if it is cleared or reused.
+ *
+ * @param[in,out] event Representation of the event.
+ */
+static inline void _evtimer_cancel(evtimer_msg_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    event->msg.type = 0;
+    irq_restore(state);
+}
 
 /**
  * @brief   Adds an event to the event timer
@@ -820,7 +924,8 @@ static inline void _evtimer_add(void *ctx, int16_t type,
 #else
     kernel_pid_t target_pid = KERNEL_PID_LAST;  /* just for testing */
 #endif
-    evtimer_del((evtimer_t *)(&_nib_evtimer), (evtimer_event_t *)event);
+    /* only events still in the list need to be taken out of it */
+    _evtimer_del(event);
     event->event.next = NULL;
     event->event.offset = offset;
     event->msg.type = type;
@@ -828,6 +933,72 @@ static inline void _evtimer_add(void *ctx, int16_t type,
     evtimer_add_msg(&_nib_evtimer, event, target_pid);
 }
 
+/**
+ * @brief   Adds an event to the event timer and records when it fires
+ *
+ * Use this instead of _evtimer_add() for events that are looked up with
+ * _evtimer_lookup(). All additions of such an event must use this function.
+ *
+ * If the event is still in the event timer's list and would fire no later
+ * than requested, it stays there and only @p until is moved: when it fires
+ * early gnrc_ipv6_nib_handle_timer_event() schedules it for the rest of the
+ * time. This makes extending a timeout, e.g. the reachable time of a
+ * neighbor, a constant time operation.
+ *
+ * @param[in] ctx       The context of the event
+ * @param[in] type      [Type of the event](@ref net_gnrc_ipv6_nib_msg).
+ * @param[in,out] event Representation of the event.
+ * @param[in,out] until Time in milliseconds the event is scheduled for.
+ * @param[in] offset    Offset in milliseconds to the event. Offsets larger
+ *                      than INT32_MAX (about 24 days) are truncated to it.
+ */
+static inline void _evtimer_add_until(void *ctx, int16_t type,
+                                      evtimer_msg_event_t *event,
+                                      uint32_t *until, uint32_t offset)
+{
+    uint32_t now = evtimer_now_msec();
+    unsigned state;
+
+    if (offset > INT32_MAX) {
+        offset = INT32_MAX;
+    }
+    /* the event must not fire between the check and the update, or the
+     * update would be sent with the old message */
+    state = irq_disable();
+    if (_evtimer_listed(event) && ((int32_t)(now + offset - *until) >= 0)) {
+        *until = now + offset;
+        event->msg.type = type;
+        event->msg.content.ptr = ctx;
+        irq_restore(state);
+        return;
+    }
+    irq_restore(state);
+    *until = now + offset;
+    _evtimer_add(ctx, type, event, offset);
+}
+
+/**
+ * @brief   Schedules an event again that was postponed by
+ *          _evtimer_add_until() and fired early
+ *
+ * @param[in] ctx   The context of the event
+ * @param[in] type  [Type of the event](@ref net_gnrc_ipv6_nib_msg).
+ *
+ * @return  true, if the event is not due yet and must not be handled.
+ * @return  false, if the event is due.
+ */
+bool _evtimer_postponed(void *ctx, uint16_t type);
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DNS) || defined(DOXYGEN)
+/**
+ * @brief   Gets the remaining lifetime of the RDNSS in @ref sock_dns_server
+ *
+ * @return  Milliseconds until the RDNSS times out.
+ * @return  UINT32_MAX, if no RDNSS timeout is scheduled.
+ */
+uint32_t _nib_rdnss_lookup(void);
+#endif  /* CONFIG_GNRC_IPV6_NIB_DNS */
+
 #ifdef __cplusplus
 }
 #endif
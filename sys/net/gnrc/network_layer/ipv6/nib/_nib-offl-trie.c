@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <kernel_defines.h>
+
+#include "_nib-offl-trie.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+/**
+ * @brief   Maximum number of trie nodes
+ *
+ * Every distinct prefix occupies one node. Branching nodes without an entry
+ * (glue nodes) always have two children, so there are at most one less of
+ * them than there are prefixes.
+ */
+#define _TRIE_NODES_NUMOF   ((2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) - 1)
+
+typedef struct _trie_node {
+    struct _trie_node *parent;      /**< parent node, NULL for the root */
+    struct _trie_node *child[2];    /**< children, indexed by the bit after
+                                     *   _trie_node_t::pfx_len (also used
+                                     *   to link free nodes) */
+    _nib_offl_entry_t *entry;       /**< entry for the prefix, NULL for
+                                     *   glue nodes */
+    ipv6_addr_t pfx;                /**< prefix represented by the node */
+    uint8_t pfx_len;                /**< length of _trie_node_t::pfx in bits */
+} _trie_node_t;
+
+static _trie_node_t _trie_nodes[_TRIE_NODES_NUMOF];
+static _trie_node_t *_root;
+static _trie_node_t *_free;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static inline unsigned _min(unsigned a, unsigned b)
+{
+    return (a < b) ? a : b;
+}
+
+static _trie_node_t *_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len,
+                                 _nib_offl_entry_t *entry)
+{
+    _trie_node_t *node = _free;
+
+    /* _TRIE_NODES_NUMOF is an upper bound to the required nodes */
+    assert(node != NULL);
+    _free = node->child[0];
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    node->entry = entry;
+    return node;
+}
+
+static void _node_free(_trie_node_t *node)
+{
+    memset(node, 0, sizeof(*node));
+    node->child[0] = _free;
+    _free = node;
+}
+
+static inline _trie_node_t **_slot(_trie_node_t *node)
+{
+    if (node->parent == NULL) {
+        return &_root;
+    }
+    return &node->parent->child[(node->parent->child[0] == node) ? 0 : 1];
+}
+
+/* replaces a node with at most one child by that child */
+static void _splice(_trie_node_t *node)
+{
+    _trie_node_t *child = (node->child[0] != NULL) ? node->child[0]
+                                                   : node->child[1];
+
+    assert((node->child[0] == NULL) || (node->child[1] == NULL));
+    *_slot(node) = child;
+    if (child != NULL) {
+        child->parent = node->parent;
+    }
+    _node_free(node);
+}
+
+void _nib_offl_trie_init(void)
+{
+    _root = NULL;
+    _free = NULL;
+    for (unsigned i = 0; i < _TRIE_NODES_NUMOF; i++) {
+        _node_free(&_trie_nodes[i]);
+    }
+}
+
+void _nib_offl_trie_add(_nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t *pfx = &dst->pfx;
+    const unsigned pfx_len = dst->pfx_len;
+    _trie_node_t **slot = &_root, *parent = NULL, *node;
+
+    assert((pfx_len > 0) && (pfx_len <= IPV6_ADDR_BIT_LEN));
+    while ((node = *slot) != NULL) {
+        unsigned common = _min(ipv6_addr_match_prefix(&node->pfx, pfx),
+                               _min(node->pfx_len, pfx_len));
+
+        if (common < node->pfx_len) {
+            /* prefix of node diverges from pfx: need to branch here */
+            _trie_node_t *new = _node_alloc(pfx, pfx_len, dst);
+
+            if (common == pfx_len) {
+                /* pfx is a prefix of node->pfx: insert as its parent */
+                new->child[_bit(&node->pfx, pfx_len)] = node;
+            }
+            else {
+                _trie_node_t *glue = _node_alloc(pfx, common, NULL);
+
+                glue->child[_bit(pfx, common)] = new;
+                glue->child[_bit(&node->pfx, common)] = node;
+                new->parent = glue;
+                new = glue;
+            }
+            new->parent = parent;
+            node->parent = new;
+            *slot = new;
+            return;
+        }
+        if (node->pfx_len == pfx_len) {
+            /* exact match: keep the entry a linear scan would find first */
+            if ((node->entry == NULL) || (dst < node->entry)) {
+                node->entry = dst;
+            }
+            return;
+        }
+        parent = node;
+        slot = &node->child[_bit(pfx, node->pfx_len)];
+    }
+    node = _node_alloc(pfx, pfx_len, dst);
+    node->parent = parent;
+    *slot = node;
+}
+
+void _nib_offl_trie_remove(const _nib_offl_entry_t *dst,
+                           _nib_offl_entry_t *repl)
+{
+    _trie_node_t *node = _root;
+
+    while ((node != NULL) && (node->pfx_len < dst->pfx_len)) {
+        node = node->child[_bit(&dst->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->entry != dst)) {
+        /* not in trie or not the representative of its prefix */
+        return;
+    }
+    if (repl != NULL) {
+        assert((repl->pfx_len == dst->pfx_len) &&
+               ipv6_addr_equal(&repl->pfx, &dst->pfx));
+        node->entry = repl;
+        return;
+    }
+    node->entry = NULL;
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        /* node still branches => keep as glue node */
+        return;
+    }
+    _trie_node_t *parent = node->parent;
+    bool leaf = (node->child[0] == NULL) && (node->child[1] == NULL);
+
+    _splice(node);
+    if (leaf && (parent != NULL) && (parent->entry == NULL)) {
+        /* glue node lost one of its two children */
+        _splice(parent);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_trie_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _trie_node_t *node = _root;
+
+    while ((node != NULL) &&
+           (ipv6_addr_match_prefix(&node->pfx, dst) >= node->pfx_len)) {
+        if ((node->entry != NULL) && (node->entry->mode != _EMPTY)) {
+            DEBUG("nib: better match %p (%u bits)\n",
+                  (void *)node->entry, node->pfx_len);
+            res = node->entry;
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->pfx_len)];
+    }
+    return res;
+}
+#else  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Longest-prefix match index over the off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ *
+ * The index is a path-compressed binary (PATRICIA) trie keyed by the prefix
+ * of each @ref _nib_offl_entry_t. It is kept in sync by
+ * @ref _nib_offl_alloc() and @ref _nib_offl_clear(), so a look-up costs at
+ * most one node per prefix bit instead of one comparison per off-link entry.
+ */
+#ifndef PRIV_NIB_OFFL_TRIE_H
+#define PRIV_NIB_OFFL_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   (Re-)Initializes the off-link trie to an empty state
+ */
+void _nib_offl_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * If there already is an entry with the same prefix in the trie, the one
+ * with the lower position in the off-link table is kept as the look-up
+ * result for that prefix, mirroring the order of a linear scan.
+ *
+ * @pre `(dst != NULL) && (dst->pfx_len > 0) && (dst->pfx_len <= 128)`
+ *
+ * @param[in] dst   An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_offl_trie_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @pre `(dst != NULL)`
+ *
+ * @param[in] dst   An off-link entry that is about to be cleared.
+ * @param[in] repl  Another off-link entry with the same prefix as @p dst
+ *                  that should take its place in the trie. May be NULL, if
+ *                  there is none.
+ */
+void _nib_offl_trie_remove(const _nib_offl_entry_t *dst,
+                           _nib_offl_entry_t *repl);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * @pre `(dst != NULL)`
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The non-empty off-link entry with the longest prefix matching
+ *          @p dst.
+ * @return  NULL, if no prefix matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_trie_match(const ipv6_addr_t *dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_OFFL_TRIE_H */
+/** @} */
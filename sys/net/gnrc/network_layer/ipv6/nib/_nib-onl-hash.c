@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "_nib-onl-hash.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+
+static _nib_onl_entry_t *_buckets[CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS];
+static _nib_onl_entry_t *_unspec;
+static _nib_onl_entry_t *_free;
+
+static inline unsigned _hash(const ipv6_addr_t *addr)
+{
+    uint32_t h = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                 addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* mix, so neighbors with sequential interface identifiers spread out */
+    h ^= h >> 16;
+    h *= 0x45d9f3bU;
+    h ^= h >> 16;
+    return h % CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS;
+}
+
+static inline _nib_onl_entry_t **_head(const ipv6_addr_t *addr)
+{
+    if (ipv6_addr_is_unspecified(addr)) {
+        return &_unspec;
+    }
+    return &_buckets[_hash(addr)];
+}
+
+static void _link(_nib_onl_entry_t **head, _nib_onl_entry_t *node)
+{
+    node->hash_next = *head;
+    if (*head != NULL) {
+        (*head)->hash_pprev = &node->hash_next;
+    }
+    node->hash_pprev = head;
+    *head = node;
+}
+
+static void _unlink(_nib_onl_entry_t *node)
+{
+    if (node->hash_pprev == NULL) {
+        return;
+    }
+    *node->hash_pprev = node->hash_next;
+    if (node->hash_next != NULL) {
+        node->hash_next->hash_pprev = node->hash_pprev;
+    }
+    node->hash_next = NULL;
+    node->hash_pprev = NULL;
+}
+
+void _nib_onl_hash_init(_nib_onl_entry_t *nodes, unsigned numof)
+{
+    memset(_buckets, 0, sizeof(_buckets));
+    _unspec = NULL;
+    _free = NULL;
+    /* link backwards, so free entries are handed out in table order */
+    for (unsigned i = numof; i > 0; i--) {
+        _nib_onl_entry_t *node = &nodes[i - 1];
+
+        node->hash_next = NULL;
+        node->hash_pprev = NULL;
+        if ((node->mode == _EMPTY) && (_nib_onl_get_if(node) == 0) &&
+            ipv6_addr_is_unspecified(&node->ipv6)) {
+            _link(&_free, node);
+        }
+        else {
+            _link(_head(&node->ipv6), node);
+        }
+    }
+}
+
+_nib_onl_entry_t *_nib_onl_hash_alloc(void)
+{
+    _nib_onl_entry_t *node = _free;
+
+    if (node != NULL) {
+        _unlink(node);
+        DEBUG("nib: using free on-link entry %p\n", (void *)node);
+    }
+    return node;
+}
+
+void _nib_onl_hash_add(_nib_onl_entry_t *node)
+{
+    _unlink(node);
+    _link(_head(&node->ipv6), node);
+}
+
+void _nib_onl_hash_free(_nib_onl_entry_t *node)
+{
+    _unlink(node);
+    memset(node, 0, sizeof(_nib_onl_entry_t));
+    _link(&_free, node);
+}
+
+_nib_onl_entry_t *_nib_onl_hash_first(const ipv6_addr_t *addr)
+{
+    return *_head(addr);
+}
+
+#else  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
+/** @} */
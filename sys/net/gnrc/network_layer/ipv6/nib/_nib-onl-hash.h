@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Hash index over the on-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH
+ *
+ * Every on-link entry is linked into exactly one of three places: the hash
+ * bucket of its _nib_onl_entry_t::ipv6, a list of in-use entries with an
+ * unspecified address, or the list of free entries. The links are
+ * doubly-linked, so moving an entry between them is constant time. The
+ * index is kept in sync by @ref _nib_onl_alloc() and @ref _nib_onl_clear().
+ */
+#ifndef PRIV_NIB_ONL_HASH_H
+#define PRIV_NIB_ONL_HASH_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+/**
+ * @brief   (Re-)Initializes the index from the current state of @p nodes
+ *
+ * Entries that are empty and carry neither address nor interface become free
+ * entries, all others are indexed by their address.
+ *
+ * @param[in,out] nodes All on-link entries.
+ * @param[in] numof     Number of entries in @p nodes.
+ */
+void _nib_onl_hash_init(_nib_onl_entry_t *nodes, unsigned numof);
+
+/**
+ * @brief   Takes a free entry out of the list of free entries
+ *
+ * @return  A cleared entry that is not linked anywhere. It needs to be
+ *          indexed with @ref _nib_onl_hash_add() once its address is set.
+ * @return  NULL, if there are no free entries left.
+ */
+_nib_onl_entry_t *_nib_onl_hash_alloc(void);
+
+/**
+ * @brief   (Re-)Indexes an entry by its current address
+ *
+ * Must be called whenever _nib_onl_entry_t::ipv6 of an entry changes.
+ *
+ * @pre `(node != NULL)`
+ *
+ * @param[in,out] node  An entry.
+ */
+void _nib_onl_hash_add(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Gets the first entry that might have address @p addr
+ *
+ * Further candidates are reached via _nib_onl_entry_t::hash_next. Entries
+ * other than those with address @p addr may be among them.
+ *
+ * @pre `(addr != NULL)`
+ *
+ * @param[in] addr  An IPv6 address.
+ *
+ * @return  The first candidate entry.
+ * @return  NULL, if there is no entry with address @p addr.
+ */
+_nib_onl_entry_t *_nib_onl_hash_first(const ipv6_addr_t *addr);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_ONL_HASH_H */
+/** @} */
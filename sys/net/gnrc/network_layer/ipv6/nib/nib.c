@@ -53,6 +53,7 @@ static gnrc_pktqueue_t _queue_pool[CONFIG_GNRC_IPV6_NIB_NUMOF];
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DNS)
 static evtimer_msg_event_t _rdnss_timeout;
+static uint32_t _rdnss_timeout_until;
 #endif
 
 /**
@@ -92,7 +93,7 @@ void gnrc_ipv6_nib_init(void)
     for (evtimer_event_t *ptr = _nib_evtimer.events;
          (ptr != NULL) && (tmp = (ptr->next), 1);
          ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+        _evtimer_del((evtimer_msg_event_t *)ptr);
     }
     _nib_init();
     _nib_release();
@@ -152,8 +153,9 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
         (gnrc_netif_is_6ln(netif) && !gnrc_netif_is_6lbr(netif))) {
         uint32_t next_rs_time = random_uint32_range(0, NDP_MAX_RS_MS_DELAY);
 
-        _evtimer_add(netif, GNRC_IPV6_NIB_SEARCH_RTR, &netif->ipv6.search_rtr,
-                     next_rs_time);
+        _evtimer_add_until(netif, GNRC_IPV6_NIB_SEARCH_RTR,
+                           &netif->ipv6.search_rtr,
+                           &netif->ipv6.search_rtr_until, next_rs_time);
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     else {
@@ -330,6 +332,11 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
     DEBUG("nib: Handle timer event (ctx = %p, type = 0x%04x, now = %ums)\n",
           ctx, type, (unsigned)evtimer_now_msec());
     _nib_acquire();
+    if (_evtimer_postponed(ctx, type)) {
+        DEBUG("nib: event was postponed\n");
+        _nib_release();
+        return;
+    }
     switch (type) {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
         case GNRC_IPV6_NIB_SND_UC_NS:
@@ -398,6 +405,48 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
     _nib_release();
 }
 
+bool _evtimer_postponed(void *ctx, uint16_t type)
+{
+    evtimer_msg_event_t *event;
+    uint32_t *until;
+
+    switch (type) {
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+            event = &((_nib_onl_entry_t *)ctx)->nud_timeout;
+            until = &((_nib_onl_entry_t *)ctx)->nud_timeout_until;
+            break;
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+            event = &((gnrc_netif_t *)ctx)->ipv6.search_rtr;
+            until = &((gnrc_netif_t *)ctx)->ipv6.search_rtr_until;
+            break;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+        case GNRC_IPV6_NIB_SND_MC_RA:
+            event = &((gnrc_netif_t *)ctx)->ipv6.snd_mc_ra;
+            until = &((gnrc_netif_t *)ctx)->ipv6.snd_mc_ra_until;
+            break;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DNS)
+        case GNRC_IPV6_NIB_RDNSS_TIMEOUT:
+            event = &_rdnss_timeout;
+            until = &_rdnss_timeout_until;
+            break;
+#endif  /* CONFIG_GNRC_IPV6_NIB_DNS */
+        default:
+            return false;
+    }
+    int32_t remaining = (int32_t)(*until - evtimer_now_msec());
+    if (remaining <= 0) {
+        return false;
+    }
+    if (!_evtimer_listed(event)) {
+        _evtimer_add_until(ctx, type, event, until, remaining);
+    }
+    return true;
+}
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
 void gnrc_ipv6_nib_change_rtr_adv_iface(gnrc_netif_t *netif, bool enable)
 {
@@ -412,8 +461,9 @@ void gnrc_ipv6_nib_change_rtr_adv_iface(gnrc_netif_t *netif, bool enable)
         netif->flags &= ~GNRC_NETIF_FLAGS_IPV6_RTR_ADV;
         /* send final router advertisements */
         _handle_snd_mc_ra(netif);
-        _evtimer_add(netif, GNRC_IPV6_NIB_SEARCH_RTR, &netif->ipv6.search_rtr,
-                     next_rs_time);
+        _evtimer_add_until(netif, GNRC_IPV6_NIB_SEARCH_RTR,
+                           &netif->ipv6.search_rtr,
+                           &netif->ipv6.search_rtr_until, next_rs_time);
     }
     gnrc_netif_release(netif);
 }
@@ -512,7 +562,8 @@ static void _handle_rtr_sol(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
     }
     if (!gnrc_netif_is_6ln(netif)) {
         uint32_t next_ra_delay = random_uint32_range(0, NDP_MAX_RA_DELAY);
-        uint32_t next_ra_scheduled = _evtimer_lookup(netif,
+        uint32_t next_ra_scheduled = _evtimer_lookup(&netif->ipv6.snd_mc_ra,
+                                                     netif->ipv6.snd_mc_ra_until,
                                                      GNRC_IPV6_NIB_SND_MC_RA);
         if (next_ra_scheduled < next_ra_delay) {
             DEBUG("nib: There is a MC RA scheduled within the next %" PRIu32 "ms. "
@@ -534,8 +585,9 @@ static void _handle_rtr_sol(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                 ((now - NDP_MIN_MS_DELAY_BETWEEN_RAS) > netif->ipv6.last_ra)) {
                 next_ra_delay += NDP_MIN_MS_DELAY_BETWEEN_RAS;
             }
-            _evtimer_add(netif, GNRC_IPV6_NIB_SND_MC_RA, &netif->ipv6.snd_mc_ra,
-                         next_ra_delay);
+            _evtimer_add_until(netif, GNRC_IPV6_NIB_SND_MC_RA,
+                               &netif->ipv6.snd_mc_ra,
+                               &netif->ipv6.snd_mc_ra_until, next_ra_delay);
         }
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LR)
@@ -756,14 +808,19 @@ static void _handle_rtr_adv(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
     }
     /* stop sending router solicitations
      * see https://tools.ietf.org/html/rfc4861#section-6.3.7 */
-    evtimer_del(&_nib_evtimer, &netif->ipv6.search_rtr.event);
+    _evtimer_cancel(&netif->ipv6.search_rtr);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN)
     if (gnrc_netif_is_6ln(netif) && !gnrc_netif_is_6lbr(netif)) {
         _set_rtr_adv(netif);
-        /* but re-fetch information from router in time */
-        _evtimer_add(netif, GNRC_IPV6_NIB_SEARCH_RTR,
-                     &netif->ipv6.search_rtr, (next_timeout >> 2) * 3);
-        /* i.e. 3/4 of the time before the earliest expires */
+        /* but re-fetch information from router in time, unless none of it
+         * times out */
+        if (next_timeout != UINT32_MAX) {
+            _evtimer_add_until(netif, GNRC_IPV6_NIB_SEARCH_RTR,
+                               &netif->ipv6.search_rtr,
+                               &netif->ipv6.search_rtr_until,
+                               (next_timeout >> 2) * 3);
+            /* i.e. 3/4 of the time before the earliest expires */
+        }
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_6LN */
 }
@@ -923,8 +980,7 @@ static void _handle_nbr_sol(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                 return;
             }
             /* cancel validation timer */
-            evtimer_del(&_nib_evtimer,
-                        &tgt_netif->ipv6.addrs_timers[idx].event);
+            _evtimer_del(&tgt_netif->ipv6.addrs_timers[idx]);
             _remove_tentative_addr(tgt_netif, &nbr_sol->tgt);
             return;
         }
@@ -1051,8 +1107,7 @@ static void _handle_nbr_adv(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
             DEBUG("nib: duplicate address detected, removing target address "
                   "from this interface\n");
             /* cancel validation timer */
-            evtimer_del(&_nib_evtimer,
-                        &tgt_netif->ipv6.addrs_timers[idx].event);
+            _evtimer_del(&tgt_netif->ipv6.addrs_timers[idx]);
             _remove_tentative_addr(tgt_netif, &nbr_adv->tgt);
             return;
         }
@@ -1147,8 +1202,9 @@ static bool _resolve_addr(const ipv6_addr_t *dst, gnrc_netif_t *netif,
     if ((entry != NULL) && (entry->mode & _NC) && _is_reachable(entry)) {
         if (_get_nud_state(entry) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE) {
             _set_nud_state(netif, entry, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_DELAY);
-            _evtimer_add(entry, GNRC_IPV6_NIB_DELAY_TIMEOUT,
-                         &entry->nud_timeout, NDP_DELAY_FIRST_PROBE_MS);
+            _evtimer_add_until(entry, GNRC_IPV6_NIB_DELAY_TIMEOUT,
+                               &entry->nud_timeout, &entry->nud_timeout_until,
+                               NDP_DELAY_FIRST_PROBE_MS);
         }
         DEBUG("nib: resolve address %s%%%u from neighbor cache\n",
               ipv6_addr_to_str(addr_str, &entry->ipv6, sizeof(addr_str)),
@@ -1266,7 +1322,7 @@ static void _handle_pfx_timeout(_nib_offl_entry_t *pfx)
 
     gnrc_netif_acquire(netif);
     if (now >= pfx->valid_until) {
-        evtimer_del(&_nib_evtimer, &pfx->pfx_timeout.event);
+        _evtimer_del(&pfx->pfx_timeout);
         for (int i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
             if (ipv6_addr_match_prefix(&netif->ipv6.addrs[i],
                                        &pfx->pfx) >= pfx->pfx_len) {
@@ -1321,7 +1377,9 @@ void _handle_search_rtr(gnrc_netif_t *netif)
 #if !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NO_RTR_SOL)
     gnrc_netif_acquire(netif);
     if (!(gnrc_netif_is_rtr_adv(netif)) || gnrc_netif_is_6ln(netif)) {
-        uint32_t next_rs = _evtimer_lookup(netif, GNRC_IPV6_NIB_SEARCH_RTR);
+        uint32_t next_rs = _evtimer_lookup(&netif->ipv6.search_rtr,
+                                           netif->ipv6.search_rtr_until,
+                                           GNRC_IPV6_NIB_SEARCH_RTR);
         uint32_t interval = _get_next_rs_interval(netif);
 
         if (next_rs > interval) {
@@ -1335,8 +1393,9 @@ void _handle_search_rtr(gnrc_netif_t *netif)
             if ((netif->ipv6.rs_sent < NDP_MAX_RS_NUMOF) ||
                 gnrc_netif_is_6ln(netif)) {
                 /* 6LN will solicitate indefinitely */
-                _evtimer_add(netif, GNRC_IPV6_NIB_SEARCH_RTR,
-                             &netif->ipv6.search_rtr, interval);
+                _evtimer_add_until(netif, GNRC_IPV6_NIB_SEARCH_RTR,
+                                   &netif->ipv6.search_rtr,
+                                   &netif->ipv6.search_rtr_until, interval);
             }
         }
     }
@@ -1351,6 +1410,12 @@ static void _handle_rdnss_timeout(sock_udp_ep_t *dns_server)
 {
     memset(dns_server, 0, sizeof(sock_udp_ep_t));
 }
+
+uint32_t _nib_rdnss_lookup(void)
+{
+    return _evtimer_lookup(&_rdnss_timeout, _rdnss_timeout_until,
+                           GNRC_IPV6_NIB_RDNSS_TIMEOUT);
+}
 #endif
 
 static void _handle_mtuo(gnrc_netif_t *netif, const icmpv6_hdr_t *icmpv6,
@@ -1401,17 +1466,20 @@ static uint32_t _handle_rdnsso(gnrc_netif_t *netif, const icmpv6_hdr_t *icmpv6,
             if (ltime < UINT32_MAX) {
                 /* the valid lifetime is given in seconds, but our timers work
                  * in milliseconds, so we have to scale down to the smallest
-                 * possible value (UINT32_MAX - 1). This is however alright
+                 * possible value (INT32_MAX, so _nib_rdnss_lookup() can
+                 * compute the remaining time). This is however alright
                  * since we ask for a new router advertisement before this
                  * timeout expires */
-                ltime = (ltime > (UINT32_MAX / MS_PER_SEC)) ?
-                              (UINT32_MAX - 1) : ltime * MS_PER_SEC;
-                _evtimer_add(&sock_dns_server, GNRC_IPV6_NIB_RDNSS_TIMEOUT,
-                             &_rdnss_timeout, ltime);
+                ltime = (ltime > (INT32_MAX / MS_PER_SEC)) ?
+                              INT32_MAX : ltime * MS_PER_SEC;
+                _evtimer_add_until(&sock_dns_server,
+                                   GNRC_IPV6_NIB_RDNSS_TIMEOUT,
+                                   &_rdnss_timeout, &_rdnss_timeout_until,
+                                   ltime);
             }
         }
         else {
-            evtimer_del(&_nib_evtimer, &_rdnss_timeout.event);
+            _evtimer_cancel(&_rdnss_timeout);
             _handle_rdnss_timeout(&sock_dns_server);
         }
     }
@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
 
@@ -56,6 +57,19 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#define RBUF_HASH_MASK  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS - 1)
+
+static_assert((CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS &
+               RBUF_HASH_MASK) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS must be a power of 2");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too large for hash chains");
+
+/* hash chains of the reassembly buffer entries. Both store the index of an
+ * entry + 1, so 0 terminates a chain */
+static uint8_t _rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS];
+static uint8_t _rbuf_chain[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -80,6 +94,10 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* looks up an entry in the hash chains, size == 0 matches any size */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              size_t size, uint16_t tag);
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -96,23 +114,26 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
+    uint16_t end = (uint16_t)(offset + frag_size - 1);
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-
+    /* intervals are sorted, so only the ones before the end of the fragment
+     * can overlap with it */
+    while ((ptr != NULL) && (ptr->start <= end)) {
+        /* adjacent fragments are merged into one interval, so a fragment
+         * within an interval was already received */
+        if ((ptr->start <= offset) && (end <= ptr->end)) {
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+            return RBUF_ADD_DUPLICATE;
+        }
+        /* If the fragment overlaps another fragment and differs in either the
+         * size or the offset of the overlapped fragment, discards the datagram
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        if (_rbuf_int_overlap_partially(ptr, offset, end)) {
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
              * https://tools.ietf.org/html/rfc4944#section-5.3 */
             return RBUF_ADD_REPEAT;
         }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
-        }
         ptr = ptr->next;
     }
     return RBUF_ADD_SUCCESS;
@@ -159,25 +180,86 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
                                                   uint16_t tag)
 {
     assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    return _rbuf_lookup(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                        netif_hdr->src_l2addr_len,
+                        gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                        netif_hdr->dst_l2addr_len, 0, tag);
+}
+
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    /* FNV-1a over the addresses, seeded with the tag */
+    uint32_t hash = 2166136261U ^ tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    return (hash ^ (hash >> 16)) & RBUF_HASH_MASK;
+}
+
+static inline unsigned _rbuf_entry_hash(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    return _rbuf_hash(e->super.src, e->super.src_len,
+                      e->super.dst, e->super.dst_len, e->super.tag);
+}
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              size_t size, uint16_t tag)
+{
+    unsigned idx = _rbuf_buckets[_rbuf_hash(src, src_len, dst, dst_len, tag)];
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_get()->rbuf_lookups++;
+#endif
+    while (idx > 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx - 1];
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->rbuf_lookup_depth++;
+#endif
         if ((e->pkt != NULL) && (e->super.tag == tag) &&
+            ((size == 0) || (e->super.datagram_size == size)) &&
             (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        idx = _rbuf_chain[idx - 1];
     }
     return NULL;
 }
 
+static void _rbuf_link(gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned hash = _rbuf_entry_hash(e);
+    unsigned idx = e - &rbuf[0];
+
+    _rbuf_chain[idx] = _rbuf_buckets[hash];
+    _rbuf_buckets[hash] = idx + 1;
+}
+
+static void _rbuf_unlink(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint8_t *ptr = &_rbuf_buckets[_rbuf_entry_hash(e)];
+    unsigned idx = e - &rbuf[0];
+
+    /* entry may not be linked, e.g. if it was already removed before */
+    while (*ptr > 0) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _rbuf_chain[idx];
+            _rbuf_chain[idx] = 0;
+            return;
+        }
+        ptr = &_rbuf_chain[*ptr - 1];
+    }
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -267,6 +349,9 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     if (_rbuf_update_ints(&entry->super, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry->super.current_size += (uint16_t)frag_size;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        entry->super.fragments++;
+#endif
         if (offset == 0) {
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
             if (sixlowpan_iphc_is(data)) {
@@ -335,30 +420,54 @@ static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size)
 {
-    gnrc_sixlowpan_frag_rb_int_t *new;
+    gnrc_sixlowpan_frag_rb_int_t *prev = NULL, *next = entry->ints;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
-    new = _rbuf_int_get_free();
-
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
-    }
-
-    new->start = offset;
-    new->end = end;
-
     DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->src,
-                                                       entry->src_len,
-                                                       l2addr_str));
+          offset, end, gnrc_netif_addr_to_str(entry->src, entry->src_len,
+                                              l2addr_str));
     DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
                                                   entry->dst_len,
                                                   l2addr_str),
           entry->datagram_size, entry->tag);
 
-    LL_PREPEND(entry->ints, new);
+    /* fragment does not overlap with any interval (see _check_fragments()),
+     * so find the intervals left and right of it */
+    while ((next != NULL) && (next->end < offset)) {
+        prev = next;
+        next = next->next;
+    }
+    if ((prev != NULL) && ((prev->end + 1) == offset)) {
+        prev->end = end;
+        if ((next != NULL) && ((end + 1) == next->start)) {
+            /* fragment closes the gap between prev and next */
+            prev->end = next->end;
+            prev->next = next->next;
+            next->start = 0;
+            next->end = 0;
+            next->next = NULL;
+        }
+    }
+    else if ((next != NULL) && ((end + 1) == next->start)) {
+        next->start = offset;
+    }
+    else {
+        gnrc_sixlowpan_frag_rb_int_t *new = _rbuf_int_get_free();
 
+        if (new == NULL) {
+            DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+            return false;
+        }
+        new->start = offset;
+        new->end = end;
+        new->next = next;
+        if (prev != NULL) {
+            prev->next = new;
+        }
+        else {
+            entry->ints = new;
+        }
+    }
     return true;
 }
 
@@ -417,35 +526,30 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    if ((size > 0) &&
+        ((res = _rbuf_lookup(src, src_len, dst, dst_len, size, tag)) != NULL)) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -514,6 +618,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    res->super.fragments = 0;
+#endif
+    _rbuf_link(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -533,6 +641,8 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    memset(_rbuf_chain, 0, sizeof(_rbuf_chain));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -550,6 +660,11 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
+    /* the base of a virtual reassembly buffer entry is not hashed */
+    if ((entry >= &rbuf[0].super) &&
+        (entry <= &rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE - 1].super)) {
+        _rbuf_unlink(container_of(entry, gnrc_sixlowpan_frag_rb_t, super));
+    }
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
@@ -580,20 +695,6 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
 }
 
-#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
-}
-#endif
-
 int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf,
                                                    gnrc_netif_hdr_t *netif_hdr)
 {
@@ -625,7 +726,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         LL_APPEND(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
+        gnrc_sixlowpan_frag_stats_get()->fragments += rbuf->super.fragments;
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
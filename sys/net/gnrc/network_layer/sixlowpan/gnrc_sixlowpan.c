@@ -315,7 +315,11 @@ static void *_event_loop(void *args)
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
 
-    /* register interest in all 6LoWPAN packets */
+    /* register interest in all 6LoWPAN packets, received ones may come in
+     * batches */
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+    me_reg.rcv_batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
 
     /* preinitialize ACK */
@@ -332,6 +336,15 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr);
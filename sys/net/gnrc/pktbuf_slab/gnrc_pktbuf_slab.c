@@ -0,0 +1,501 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated free lists per size class
+ *
+ * Every size class is a pool of equally sized blocks linked into a free
+ * list, so allocation and deallocation do not depend on the number of
+ * packets in the buffer. Data of a snip is always contained in a single
+ * block. Since gnrc_pktbuf_mark() splits data in place, several snips may
+ * share a block; the block is returned to its free list when the last of
+ * them is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/* all block sizes are multiples of this to keep blocks aligned */
+#define _ALIGNMENT          (sizeof(uint64_t))
+#define _ALIGN(size)        (((size) + _ALIGNMENT - 1) & ~(_ALIGNMENT - 1))
+
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _HDR_SIZE           _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE)
+#define _FRAME_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE)
+#define _MTU_SIZE           _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE)
+
+/* backing memory of a size class, in units of _ALIGNMENT */
+#define _POOL(name, size, numof) \
+    static uint64_t name[((size) * (numof)) / _ALIGNMENT]
+
+typedef struct _free_block {
+    struct _free_block *next;
+} _free_block_t;
+
+typedef struct {
+    uint8_t *const pool;        /**< backing memory of the blocks */
+    uint8_t *const refs;        /**< number of snips using each block */
+    const size_t size;          /**< size of a block in bytes */
+    const unsigned numof;       /**< number of blocks */
+    _free_block_t *free;        /**< free list */
+    unsigned used;              /**< number of blocks in use */
+    unsigned max_used;          /**< maximum number of blocks in use */
+    size_t requested;           /**< bytes requested from blocks in use */
+    unsigned spilled;           /**< allocations that had to use this class
+                                 *   since all smaller fitting ones were
+                                 *   exhausted */
+} _slab_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+_POOL(_snip_pool, _SNIP_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF);
+_POOL(_hdr_pool, _HDR_SIZE, CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF);
+_POOL(_frame_pool, _FRAME_SIZE, CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF);
+_POOL(_mtu_pool, _MTU_SIZE, CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF);
+
+static uint8_t _snip_refs[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static uint8_t _hdr_refs[CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF];
+static uint8_t _frame_refs[CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF];
+static uint8_t _mtu_refs[CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF];
+
+/* sorted by ascending block size */
+static _slab_t _slabs[] = {
+    { .pool = (uint8_t *)_snip_pool, .refs = _snip_refs, .size = _SNIP_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    { .pool = (uint8_t *)_hdr_pool, .refs = _hdr_refs, .size = _HDR_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF },
+    { .pool = (uint8_t *)_frame_pool, .refs = _frame_refs, .size = _FRAME_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF },
+    { .pool = (uint8_t *)_mtu_pool, .refs = _mtu_refs, .size = _MTU_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF },
+};
+
+#define _SLABS_NUMOF        ARRAY_SIZE(_slabs)
+#define _MAX_SIZE           (CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE)
+
+/* allocations that failed although enough bytes were free in total */
+static unsigned _frag_failed;
+/* allocations that failed */
+static unsigned _failed;
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_free(void *data, size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - slab->pool) < (slab->size * slab->numof);
+}
+
+static _slab_t *_slab_of(const void *ptr)
+{
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+static inline unsigned _block_idx(const _slab_t *slab, const void *ptr)
+{
+    return ((uint8_t *)ptr - slab->pool) / slab->size;
+}
+
+static inline size_t _block_offset(const _slab_t *slab, const void *ptr)
+{
+    return ((uint8_t *)ptr - slab->pool) % slab->size;
+}
+
+static void _slab_init(_slab_t *slab)
+{
+    slab->free = NULL;
+    /* push in reverse so blocks are handed out in ascending order */
+    for (unsigned i = slab->numof; i > 0; i--) {
+        _free_block_t *block = (_free_block_t *)(slab->pool +
+                                                 ((i - 1) * slab->size));
+
+        block->next = slab->free;
+        slab->free = block;
+        slab->refs[i - 1] = 0;
+    }
+    slab->used = 0;
+    slab->max_used = 0;
+    slab->requested = 0;
+    slab->spilled = 0;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        _slab_init(&_slabs[i]);
+    }
+    _frag_failed = 0;
+    _failed = 0;
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _MAX_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE (%u)\n",
+              (unsigned)size, (unsigned)_MAX_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    else {
+        /* both snips now share the block of the original data */
+        _slab_t *slab = _slab_of(pkt->data);
+
+        assert(slab != NULL);
+        assert(slab->refs[_block_idx(slab, pkt->data)] < UINT8_MAX);
+        slab->refs[_block_idx(slab, pkt->data)]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _slab_of(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else if (pkt->data != NULL) {
+        _slab_t *slab = _slab_of(pkt->data);
+        unsigned idx = _block_idx(slab, pkt->data);
+
+        /* shrink in place or grow into the rest of an exclusively used block */
+        if ((size < pkt->size) ||
+            ((slab->refs[idx] == 1) &&
+             ((_block_offset(slab, pkt->data) + size) <= slab->size))) {
+            slab->requested -= pkt->size;
+            slab->requested += size;
+        }
+        else {
+            void *new_data = _pktbuf_alloc(size);
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&_mutex);
+                return ENOMEM;
+            }
+            memcpy(new_data, pkt->data, pkt->size);
+            _pktbuf_free(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    else {
+        void *new_data = _pktbuf_alloc(size);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_of(pkt) != NULL);
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data, pkt->size);
+            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    size_t total = 0, used = 0, requested = 0;
+
+    mutex_lock(&_mutex);
+    puts("packet buffer: size classes");
+    puts("  block size | used | max used | total | spilled | slack bytes");
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        const _slab_t *slab = &_slabs[i];
+        size_t slab_used = slab->used * slab->size;
+
+        printf("  %10u | %4u | %8u | %5u | %7u | %11u\n",
+               (unsigned)slab->size, slab->used, slab->max_used, slab->numof,
+               slab->spilled, (unsigned)(slab_used - slab->requested));
+        total += slab->size * slab->numof;
+        used += slab_used;
+        requested += slab->requested;
+    }
+    printf("  bytes in use: %u of %u (%u requested, %u%% internal "
+           "fragmentation)\n", (unsigned)used, (unsigned)total,
+           (unsigned)requested,
+           (used > 0) ? (unsigned)(((used - requested) * 100) / used) : 0);
+    printf("  failed allocations: %u (%u despite enough free bytes)\n",
+           _failed, _frag_failed);
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in free list of slab: block in slab, block aligned to
+     *    slab->size, and no snip refers to it
+     *  - forall slabs: length of free list + slab->used == slab->numof
+     *  - forall slabs: slab->requested <= slab->used * slab->size
+     */
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        const _slab_t *slab = &_slabs[i];
+        unsigned free_blocks = 0;
+
+        for (_free_block_t *ptr = slab->free; ptr != NULL; ptr = ptr->next) {
+            if (!_slab_contains(slab, ptr) ||
+                (_block_offset(slab, ptr) != 0) ||
+                (slab->refs[_block_idx(slab, ptr)] != 0) ||
+                (++free_blocks > slab->numof)) {
+                return false;
+            }
+        }
+        if (((free_blocks + slab->used) != slab->numof) ||
+            (slab->requested > (slab->used * slab->size))) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    bool spilled = false;
+
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        _free_block_t *block = slab->free;
+
+        if (size > slab->size) {
+            continue;
+        }
+        if (block == NULL) {
+            spilled = true;
+            continue;
+        }
+        slab->free = block->next;
+        slab->refs[_block_idx(slab, block)] = 1;
+        slab->requested += size;
+        if (++slab->used > slab->max_used) {
+            slab->max_used = slab->used;
+        }
+        if (spilled) {
+            slab->spilled++;
+        }
+        return block;
+    }
+    DEBUG("pktbuf: no block of size %u left in packet buffer\n",
+          (unsigned)size);
+    _failed++;
+    size_t free_bytes = 0;
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        free_bytes += (_slabs[i].numof - _slabs[i].used) * _slabs[i].size;
+    }
+    if (free_bytes >= size) {
+        _frag_failed++;
+    }
+    return NULL;
+}
+
+static void _pktbuf_free(void *data, size_t size)
+{
+    _slab_t *slab = (data != NULL) ? _slab_of(data) : NULL;
+
+    if (slab == NULL) {
+        return;
+    }
+    unsigned idx = _block_idx(slab, data);
+
+    assert(slab->refs[idx] > 0);
+    assert(slab->requested >= size);
+    slab->requested -= size;
+    if (--slab->refs[idx] == 0) {
+        _free_block_t *block = (_free_block_t *)(slab->pool + (idx * slab->size));
+
+        block->next = slab->free;
+        slab->free = block;
+        slab->used--;
+    }
+}
+
+/** @} */
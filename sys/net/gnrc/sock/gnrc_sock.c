@@ -173,7 +173,8 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
 }
 
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+                       const sock_ip_ep_t *remote, uint8_t nh,
+                       uint8_t netif_hdr_flags)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -221,7 +222,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         /* TODO: use API in #5511 */
         iface = (kernel_pid_t)remote->netif;
     }
-    if (iface != KERNEL_PID_UNDEF) {
+    if ((iface != KERNEL_PID_UNDEF) || (netif_hdr_flags != 0)) {
         gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
         gnrc_netif_hdr_t *netif_hdr;
 
@@ -231,6 +232,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         }
         netif_hdr = netif->data;
         netif_hdr->if_pid = iface;
+        netif_hdr->flags = netif_hdr_flags;
         LL_PREPEND(pkt, netif);
     }
 #ifdef MODULE_GNRC_NETERR
@@ -121,9 +121,13 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
 /**
  * @brief   Send a packet internally
  * @internal
+ *
+ * @p netif_hdr_flags are passed to the network layer in a
+ * @ref gnrc_netif_hdr_t, e.g. @ref GNRC_NETIF_HDR_FLAGS_CSUM_PRESET.
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh);
+                       const sock_ip_ep_t *remote, uint8_t nh,
+                       uint8_t netif_hdr_flags);
 /**
  * @}
  */
@@ -133,7 +133,12 @@ struct sock_udp {
     gnrc_sock_reg_t reg;                   /**< netreg info */
     sock_udp_ep_t local;                   /**< local end-point */
     sock_udp_ep_t remote;                  /**< remote end-point */
+    gnrc_pktsnip_t *recv_snip;             /**< payload snip handed out last
+                                            *   by sock_udp_recv_buf() */
     uint16_t flags;                        /**< option flags */
+    uint16_t csum_pseudo;                  /**< partial checksum over the
+                                            *   local and remote address,
+                                            *   0 if not both are fixed */
 };
 
 #ifdef __cplusplus
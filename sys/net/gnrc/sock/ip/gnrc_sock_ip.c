@@ -214,7 +214,7 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     if (pkt == NULL) {
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, &rem, proto);
+    res = gnrc_sock_send(pkt, &local, &rem, proto, 0);
     if (res <= 0) {
         return res;
     }
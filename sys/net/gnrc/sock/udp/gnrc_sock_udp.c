@@ -20,8 +20,10 @@
 
 #include "byteorder.h"
 #include "net/af.h"
+#include "net/inet_csum.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
@@ -82,6 +84,37 @@ static uint16_t _get_dyn_port(sock_udp_t *sock)
     return GNRC_SOCK_DYN_PORTRANGE_ERR;
 }
 
+/**
+ * @brief   Sets the checksum of a UDP packet from the partial checksum over
+ *          the addresses of its pseudo-header
+ *
+ * The packet is sent with @ref GNRC_NETIF_HDR_FLAGS_CSUM_PRESET, so gnrc_ipv6
+ * keeps the checksum set here and does not need to sum up the addresses for
+ * every packet again.
+ */
+static void _set_csum(gnrc_pktsnip_t *pkt, uint16_t csum_pseudo)
+{
+    udp_hdr_t *hdr = pkt->data;
+    uint16_t len = gnrc_pkt_len(pkt);
+    uint16_t csum = csum_pseudo;
+    size_t accum_len = 0;
+
+    hdr->length = byteorder_htons(len);
+    if (((uint32_t)csum + len + PROTNUM_UDP) > 0xffff) {
+        /* increment by one for overflow to keep it as 1's complement sum */
+        csum++;
+    }
+    csum += len + PROTNUM_UDP;
+    for (gnrc_pktsnip_t *snip = pkt; snip != NULL; snip = snip->next) {
+        /* a snip may start at an odd offset of the packet */
+        csum = inet_csum_slice(csum, snip->data, snip->size, accum_len);
+        accum_len += snip->size;
+    }
+    /* RFC 8200, section 8.1: a calculated checksum of zero is sent as
+     * 0xffff */
+    hdr->checksum = byteorder_htons((csum == 0xffff) ? 0xffff : (uint16_t)~csum);
+}
+
 int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
                     const sock_udp_ep_t *remote, uint16_t flags)
 {
@@ -137,6 +170,17 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
         /* listen only with local given */
         gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, sock->local.port);
     }
+    sock->csum_pseudo = 0;
+#ifdef SOCK_HAS_IPV6
+    if ((local != NULL) && (remote != NULL) &&
+        !gnrc_ep_addr_any((const sock_ip_ep_t *)local)) {
+        /* addresses of the pseudo-header won't change for this sock */
+        sock->csum_pseudo = inet_csum(0, local->addr.ipv6,
+                                      sizeof(local->addr.ipv6));
+        sock->csum_pseudo = inet_csum(sock->csum_pseudo, remote->addr.ipv6,
+                                      sizeof(remote->addr.ipv6));
+    }
+#endif
     sock->flags = flags;
     return 0;
 }
@@ -183,7 +227,7 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
 
     assert((sock != NULL) && (data != NULL) && (max_len > 0));
     while ((res = sock_udp_recv_buf(sock, &pkt, &ctx, timeout, remote)) > 0) {
-        if (res > (ssize_t)max_len) {
+        if (res > (ssize_t)(max_len - ret)) {
             nobufs = true;
             continue;
         }
@@ -204,6 +248,19 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
 
     assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
     if (*buf_ctx != NULL) {
+        pkt = *buf_ctx;
+
+        if (pkt != sock->recv_snip) {
+            /* payload is split over several snips: received packets list
+             * them in reverse order, so the snip in front of the one handed
+             * out last continues the data. Hand it out without copying */
+            while (pkt->next != sock->recv_snip) {
+                pkt = pkt->next;
+            }
+            sock->recv_snip = pkt;
+            *data = pkt->data;
+            return (ssize_t)pkt->size;
+        }
         *data = NULL;
         gnrc_pktbuf_release(*buf_ctx);
         *buf_ctx = NULL;
@@ -235,14 +292,31 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
-    *data = pkt->data;
     *buf_ctx = pkt;
+    /* the payload snip next to the UDP header holds the start of the data */
+    while (pkt->next != udp) {
+        pkt = pkt->next;
+    }
+    sock->recv_snip = pkt;
+    *data = pkt->data;
     res = (int)pkt->size;
     return res;
 }
 
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len = len,
+    };
+
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+    return sock_udp_sendv(sock, &snip, remote);
+}
+
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote)
 {
     int res;
     gnrc_pktsnip_t *payload, *pkt;
@@ -250,9 +324,10 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     sock_ip_ep_t local;
     sock_udp_ep_t remote_cpy;
     sock_ip_ep_t *rem;
+    uint8_t *ptr;
+    uint8_t netif_hdr_flags = 0;
 
     assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
 
     if (remote != NULL) {
         if (remote->port == 0) {
@@ -324,17 +399,30 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     else if (local.family != rem->family) {
         return -EINVAL;
     }
-    /* generate payload and header snips */
-    payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
+    /* generate payload and header snips: the buffers are copied straight
+     * into the packet buffer, so the caller does not need to assemble them */
+    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips),
+                              GNRC_NETTYPE_UNDEF);
     if (payload == NULL) {
         return -ENOMEM;
     }
+    ptr = payload->data;
+    for (const iolist_t *snip = snips; snip != NULL; snip = snip->iol_next) {
+        if (snip->iol_len > 0) {
+            memcpy(ptr, snip->iol_base, snip->iol_len);
+            ptr += snip->iol_len;
+        }
+    }
     pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    if ((remote == NULL) && (sock->csum_pseudo != 0)) {
+        _set_csum(pkt, sock->csum_pseudo);
+        netif_hdr_flags = GNRC_NETIF_HDR_FLAGS_CSUM_PRESET;
+    }
+    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP, netif_hdr_flags);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -474,6 +474,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     cb_arg_t probe_timeout_arg = {MSG_TYPE_PROBE_TIMEOUT, &(tcb->mbox)};
     uint32_t probe_timeout_duration_us = 0;
     ssize_t ret = 0;
+    ssize_t acked = 0;
     bool probing_mode = false;
 
     /* Lock the TCB for this function call */
@@ -501,8 +502,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and everything sent was acked */
+    while (ret >= 0) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -521,9 +522,14 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data in case we are not probing */
+        if ((size_t)ret < len && !probing_mode) {
+            ret += _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *) data + ret, len - ret);
+        }
+
+        /* Return if everything sent so far was acked */
+        if (ret > 0 && tcb->pkt_retransmit_numof == 0) {
+            break;
         }
 
         /* Wait for responses */
@@ -531,12 +537,14 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : CONNECTION_TIMEOUT\n");
+                acked = ret - (ssize_t)(tcb->snd_nxt - tcb->snd_una);
                 _fsm(tcb, FSM_EVENT_TIMEOUT_CONNECTION, NULL, NULL, 0);
                 ret = -ECONNABORTED;
                 break;
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
+                acked = ret - (ssize_t)(tcb->snd_nxt - tcb->snd_una);
                 _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 ret = -ETIMEDOUT;
                 break;
@@ -575,6 +583,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         }
     }
 
+    /* Report the bytes the peer already acknowledged, so they are not sent twice */
+    if (acked > 0) {
+        ret = acked;
+    }
+
     /* Cleanup */
     xtimer_remove(&probe_timeout);
     xtimer_remove(&connection_timeout);
@@ -172,7 +172,8 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
 
     /* Validate checksum */
-    if (byteorder_ntohs(hdr->checksum) != _pkt_calc_csum(tcp, ip, pkt)) {
+    if (!gnrc_netif_hdr_rx_csum_offloaded(pkt) &&
+        (byteorder_ntohs(hdr->checksum) != _pkt_calc_csum(tcp, ip, pkt))) {
         DEBUG("gnrc_tcp_eventloop.c : _receive() : Invalid checksum\n");
 #ifndef MODULE_FUZZING
         gnrc_pktbuf_release(pkt);
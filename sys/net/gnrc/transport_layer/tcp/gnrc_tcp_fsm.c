@@ -83,11 +83,16 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->pkt_retransmit_numof > 0) {
+        for (unsigned i = 0; i < tcb->pkt_retransmit_numof; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        tcb->pkt_retransmit_numof = 0;
     }
+    tcb->pkt_sacked = 0;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_RTT_PENDING;
     return 0;
 }
 
@@ -147,6 +152,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             }
 #endif
             tcb->peer_port = PORT_UNSPEC;
+            tcb->status &= ~STATUS_SACK_PERMITTED;
 
             /* Allocate receive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
@@ -163,6 +169,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
+            tcb->status &= ~STATUS_SACK_PERMITTED;
+
             /* Allocate rceveive buffer */
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
@@ -267,24 +275,35 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Send segments while the window is open and the retransmit queue is not full */
+    while (sent < len && tcb->snd_wnd > 0 &&
+           tcb->pkt_retransmit_numof < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+
+        /* Stop if the window is filled by segments in flight */
+        if (payload == 0 || payload > tcb->snd_wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < len - sent) ? payload : len - sent;
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -633,7 +652,19 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _pkt_acknowledge(tcb, seg_ack);
+                    _option_process_sack(tcb, tcp_hdr);
+                }
+                /* Duplicate ACK: Retransmit without waiting for the timeout */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd && tcb->pkt_retransmit_numof > 0) {
+                    _option_process_sack(tcb, tcp_hdr);
+                    /* Saturate, so only the threshold triggers a fast retransmit */
+                    if (tcb->dup_acks < UINT8_MAX &&
+                        ++tcb->dup_acks == TCP_DUP_ACK_THRESHOLD) {
+                        _pkt_fast_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -657,25 +688,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -729,7 +760,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_numof == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -771,9 +802,12 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_numof > 0) {
+        /* The peer may have discarded SACKed data (see RFC 2018, section 8) */
+        tcb->pkt_sacked = 0;
+        tcb->dup_acks = 0;
+        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
@@ -16,8 +16,11 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+#include "kernel_defines.h"
 #include "internal/common.h"
 #include "internal/option.h"
+#include "internal/pkt.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -25,7 +28,8 @@
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         return 0;
     }
@@ -62,6 +66,33 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                       tcb->mss);
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK permitted Option length.\n");
+                    return -1;
+                }
+                /* SACK is negotiated during connection setup only */
+                if (IS_USED(MODULE_GNRC_TCP_SACK) && (ctl & MSK_SYN)) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK permitted option found\n");
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK Option length.\n");
+                    return -1;
+                }
+                /* Blocks are applied by _option_process_sack() once the segment was
+                 * found acceptable */
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK option found\n");
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     DEBUG("gnrc_tcp_option.c : _option_parse() : Unsupported option found.\
@@ -80,3 +111,45 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     }
     return 0;
 }
+
+void _option_process_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+{
+    if (!IS_USED(MODULE_GNRC_TCP_SACK) || !(tcb->status & STATUS_SACK_PERMITTED)) {
+        return;
+    }
+
+    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    if (offset <= TCP_HDR_OFFSET_MIN) {
+        return;
+    }
+
+    /* Option lengths were verified by _option_parse() */
+    uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
+    uint8_t opt_left = (offset - TCP_HDR_OFFSET_MIN) * 4;
+
+    while (opt_left > 0) {
+        tcp_hdr_opt_t *option = (tcp_hdr_opt_t *) opt_ptr;
+
+        if (option->kind == TCP_OPTION_KIND_EOL) {
+            return;
+        }
+        if (option->kind == TCP_OPTION_KIND_NOP) {
+            opt_ptr += 1;
+            opt_left -= 1;
+            continue;
+        }
+        if (option->kind == TCP_OPTION_KIND_SACK) {
+            for (uint8_t i = 0; i < option->length - TCP_OPTION_LENGTH_MIN;
+                 i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                network_uint32_t left;
+                network_uint32_t right;
+
+                memcpy(&left, &option->value[i], sizeof(left));
+                memcpy(&right, &option->value[i + sizeof(left)], sizeof(right));
+                _pkt_sack(tcb, byteorder_ntohl(left), byteorder_ntohl(right));
+            }
+        }
+        opt_ptr += option->length;
+        opt_left -= option->length;
+    }
+}
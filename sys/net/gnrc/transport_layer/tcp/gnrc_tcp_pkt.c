@@ -20,6 +20,7 @@
 #include <utlist.h>
 #include <errno.h>
 #include "byteorder.h"
+#include "kernel_defines.h"
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "internal/common.h"
@@ -33,6 +34,11 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+/* gnrc_tcp_tcb_t::pkt_sacked holds one bit per packet in the retransmit queue */
+static_assert((CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE >= 1) &&
+              (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE <= 8),
+              "CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE must be between 1 and 8");
+
 /**
  * @brief Calculates the maximum of two unsigned numbers.
  *
@@ -46,6 +52,70 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Gets the TCP header of a packet.
+ *
+ * @param[in] pkt   Packet containing a TCP header.
+ *
+ * @returns   Pointer to the TCP header.
+ */
+static inline tcp_hdr_t *_pkt_get_tcp_hdr(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    return (tcp_hdr_t *) snp->data;
+}
+
+/**
+ * @brief Gets the sequence number of a packet.
+ *
+ * @param[in] pkt   Packet containing a TCP header.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static inline uint32_t _pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    return byteorder_ntohl(_pkt_get_tcp_hdr(pkt)->seq_num);
+}
+
+/**
+ * @brief Calculates the RTO from the current round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rto_update(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY, CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Starts the retransmission timer for the oldest packet in the retransmit queue.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rto_start_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_tout.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
 int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
 {
     tcp_hdr_t tcp_hdr_out;
@@ -147,6 +217,7 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    bool sack_perm = false;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -171,6 +242,12 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Offer SACK on SYN, accept it on SYN+ACK if the peer offered it */
+        if (IS_USED(MODULE_GNRC_TCP_SACK) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+            sack_perm = true;
+            offset += 1;
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
@@ -203,8 +280,14 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             if (ctl & MSK_SYN) {
                 network_uint32_t mss_option = byteorder_htonl(_option_build_mss(CONFIG_GNRC_TCP_MSS));
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add SACK permitted option, if SACK is offered or accepted */
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(_option_build_sack_perm());
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -267,14 +350,22 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
+
+        /* Measure time of one segment per round trip */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = xtimer_now().ticks32;
+        }
     }
     else {
         tcb->retries += 1;
+
+        /* Discard pending time measurement (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -351,7 +442,6 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
 
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
 {
-    gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
 
@@ -361,15 +451,8 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
-    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
-    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
+    ctl = byteorder_ntohs(_pkt_get_tcp_hdr(pkt)->off_ctl);
     len = _pkt_get_pay_len(pkt);
 
     /* Check if pkt contains reset or is a pure ACK, return */
@@ -377,21 +460,29 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
+        /* Check if retransmit queue is full */
+        if (tcb->pkt_retransmit_numof >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
+            return -ENOMEM;
         }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY, CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* Append pkt and increase users: every send attempt consumes a user */
+        tcb->pkt_retransmit[tcb->pkt_retransmit_numof++] = pkt;
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* The timer covers the oldest packet. It is already running for later ones */
+        if (tcb->pkt_retransmit_numof > 1) {
+            return 0;
         }
+        tcb->retries = 0;
+        _rto_update(tcb);
     }
     else {
+        /* Only the oldest packet is retransmitted on timeout */
+        assert(tcb->pkt_retransmit_numof > 0 && tcb->pkt_retransmit[0] == pkt);
+        gnrc_pktbuf_hold(pkt, 1);
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -402,51 +493,48 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
     }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_tout.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+    _rto_start_timer(tcb);
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_numof == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+    /* Release all packets whose last sequence number is covered by ack */
+    while (acked < tcb->pkt_retransmit_numof) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _pkt_get_seq_num(pkt) + _pkt_get_seg_len(pkt) - 1;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    tcb->pkt_retransmit_numof -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_numof * sizeof(tcb->pkt_retransmit[0]));
+    tcb->pkt_sacked >>= acked;
+    xtimer_remove(&(tcb->tim_tout));
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -461,9 +549,52 @@ int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart timer for the oldest packet still in flight (see RFC 6298, 5.3) */
+    if (tcb->pkt_retransmit_numof > 0) {
+        tcb->retries = 0;
+        _rto_update(tcb);
+        _rto_start_timer(tcb);
+    }
+    return 0;
+}
+
+int _pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->pkt_retransmit_numof == 0) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_fast_retransmit() : There is no packet to retransmit\n");
+        return -ENODATA;
+    }
+
+    /* Retransmit the oldest packet and every packet that was not SACKed by the peer
+     * although a later one was. The retransmission timer is left untouched. */
+    for (unsigned i = 0; i < tcb->pkt_retransmit_numof; i++) {
+        unsigned sacked = tcb->pkt_sacked >> i;
+
+        if (i > 0 && sacked == 0) {
+            break;
+        }
+        if (i > 0 && (sacked & 1)) {
+            continue;
+        }
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[i], 1);
+        _pkt_send(tcb, tcb->pkt_retransmit[i], 0, true);
+    }
     return 0;
 }
 
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    for (unsigned i = 0; i < tcb->pkt_retransmit_numof; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _pkt_get_seq_num(pkt);
+
+        if (LEQ_32_BIT(left, seq) && LEQ_32_BIT(seq + _pkt_get_seg_len(pkt), right)) {
+            tcb->pkt_sacked |= (1 << i);
+        }
+    }
+}
+
 uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr,
                         const gnrc_pktsnip_t *payload)
 {
@@ -47,8 +47,15 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_WAIT_FOR_MSG   (1 << 3)
+#define STATUS_RTT_PENDING    (1 << 4)
+#define STATUS_SACK_PERMITTED (1 << 5)
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681).
+ */
+#define TCP_DUP_ACK_THRESHOLD (3U)
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -42,6 +42,20 @@ static inline uint32_t _option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK permitted option.
+ *
+ * The option is padded with two NOP options to a multiple of four bytes.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -67,6 +81,18 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
  */
 int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Applies the SACK blocks of a given TCP header to the retransmit queue.
+ *
+ * @pre @p hdr was accepted by _option_parse().
+ *
+ * @note Call this only for segments that passed the acceptability checks.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     hdr   TCP header containing the SACK option.
+ */
+void _option_process_sack(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -108,6 +108,10 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * The packet is appended to the retransmit queue. The retransmission timer
+ * always covers the oldest packet in the queue. If @p retransmit is set,
+ * @p pkt must be the oldest packet and the timer is restarted with backoff.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
@@ -119,7 +123,7 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -129,6 +133,29 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Retransmits packets after duplicate acknowledgments (see RFC 5681).
+ *
+ * Retransmits the oldest packet in the retransmit queue. If the peer
+ * selectively acknowledged later packets, the packets in between are
+ * retransmitted as well.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is nothing to retransmit.
+ */
+int _pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Marks packets in the retransmit queue as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of a SACK block.
+ * @param[in]     right   Right edge of a SACK block.
+ */
+void _pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
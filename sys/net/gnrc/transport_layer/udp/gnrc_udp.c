@@ -146,7 +146,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
-    if (_calc_csum(udp, ipv6, pkt) != 0xFFFF) {
+    if (!gnrc_netif_hdr_rx_csum_offloaded(pkt) &&
+        (_calc_csum(udp, ipv6, pkt) != 0xFFFF)) {
         DEBUG("udp: received packet with invalid checksum, dropping it\n");
         gnrc_pktbuf_release(pkt);
         return;
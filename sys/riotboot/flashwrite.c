@@ -59,14 +59,86 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
     state->target_slot = target_slot;
     state->flashpage = flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
 
+#if IS_USED(MODULE_PERIPH_FLASHPAGE_RAW)
+    /* invalidate the slot right away, the data is written in place */
+    flashpage_write(state->flashpage, NULL);
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    sha256_init(&state->sha256);
+#endif
+
     return 0;
 }
 
+#if IS_USED(MODULE_PERIPH_FLASHPAGE_RAW)
+/* Write the buffered data of the current page up to flashpage_pos to flash.
+ * Only complete write blocks are written, unless pad is set. */
+static int _write_raw(riotboot_flashwrite_t *state, size_t flashpage_pos,
+                      bool pad)
+{
+    size_t end = flashpage_pos - flashpage_pos % FLASHPAGE_RAW_BLOCKSIZE;
+
+    if (pad && (end < flashpage_pos)) {
+        end += FLASHPAGE_RAW_BLOCKSIZE;
+    }
+    if (end <= state->flashpage_written) {
+        return 0;
+    }
+
+    uint8_t *src = state->flashpage_buf + state->flashpage_written;
+    uint8_t *dst = (uint8_t *)flashpage_addr(state->flashpage) +
+                   state->flashpage_written;
+    size_t len = end - state->flashpage_written;
+
+    flashpage_write_raw(dst, src, len);
+    if (memcmp(dst, src, len) != 0) {
+        return -1;
+    }
+    state->flashpage_written = end;
+    return 0;
+}
+
+static int _write_page(riotboot_flashwrite_t *state, size_t flashpage_pos,
+                       bool more)
+{
+    bool page_done = (flashpage_pos == FLASHPAGE_SIZE);
+
+    if (_write_raw(state, flashpage_pos, page_done || !more) < 0) {
+        return -1;
+    }
+    if (page_done) {
+        state->flashpage++;
+        state->flashpage_written = 0;
+        if (more && (state->offset < riotboot_flashwrite_slotsize(state))) {
+            /* erase ahead, so that the next page can be written in chunks */
+            flashpage_write(state->flashpage, NULL);
+        }
+    }
+    return 0;
+}
+#else
+static int _write_page(riotboot_flashwrite_t *state, size_t flashpage_pos,
+                       bool more)
+{
+    if ((flashpage_pos == FLASHPAGE_SIZE) || (!more)) {
+        if (flashpage_write_and_verify(state->flashpage, state->flashpage_buf) != FLASHPAGE_OK) {
+            return -1;
+        }
+        state->flashpage++;
+    }
+    return 0;
+}
+#endif
+
 int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                                  const uint8_t *bytes, size_t len, bool more)
 {
     LOG_DEBUG(LOG_PREFIX "processing bytes %u-%u\n", state->offset, state->offset + len - 1);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    sha256_update(&state->sha256, bytes, len);
+#endif
+
     while (len) {
         size_t flashpage_pos = state->offset % FLASHPAGE_SIZE;
         size_t flashpage_avail = FLASHPAGE_SIZE - flashpage_pos;
@@ -74,17 +146,13 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
         size_t to_copy = min(flashpage_avail, len);
 
         memcpy(state->flashpage_buf + flashpage_pos, bytes, to_copy);
-        flashpage_avail -= to_copy;
 
         state->offset += to_copy;
         bytes += to_copy;
         len -= to_copy;
-        if ((!flashpage_avail) || (!more)) {
-            if (flashpage_write_and_verify(state->flashpage, state->flashpage_buf) != FLASHPAGE_OK) {
-                LOG_WARNING(LOG_PREFIX "error writing flashpage %u!\n", state->flashpage);
-                return -1;
-            }
-            state->flashpage++;
+        if (_write_page(state, flashpage_pos + to_copy, more || len) < 0) {
+            LOG_WARNING(LOG_PREFIX "error writing flashpage %u!\n", state->flashpage);
+            return -1;
         }
     }
 
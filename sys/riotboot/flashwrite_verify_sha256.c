@@ -25,6 +25,7 @@
 
 #include "hashes/sha256.h"
 #include "log.h"
+#include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest, size_t img_len, int target_slot)
@@ -55,3 +56,23 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest, size_t img_l
 
     return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
 }
+
+int riotboot_flashwrite_verify_sha256_stream(const uint8_t *sha256_digest,
+                                             size_t img_len,
+                                             const riotboot_flashwrite_t *state)
+{
+    char digest[SHA256_DIGEST_LENGTH];
+
+    /* finalize a copy, so the state stays usable */
+    sha256_context_t sha256 = state->sha256;
+
+    if (state->offset != img_len) {
+        LOG_INFO("riotboot: verify_sha256_stream(): wrote %u bytes, expected %u\n",
+                 (unsigned)state->offset, (unsigned)img_len);
+        return -1;
+    }
+
+    sha256_final(&sha256, digest);
+
+    return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
+}
@@ -30,6 +30,8 @@ int _gnrc_6lo_frag_stats(int argc, char **argv)
 #endif
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
+    printf("rbuf look-ups: %u (%u entries compared)\n", stats->rbuf_lookups,
+           stats->rbuf_lookup_depth);
     return 0;
 }
 
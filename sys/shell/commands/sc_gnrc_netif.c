@@ -126,17 +126,28 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
     }
     else {
         printf("          Statistics for %s\n"
-               "            RX packets %u  bytes %u\n"
-               "            TX packets %u (Multicast: %u)  bytes %u\n"
-               "            TX succeeded %u errors %u\n",
+               "            RX packets %u  bytes %u",
                _netstats_module_to_str(module),
                (unsigned) stats->rx_count,
-               (unsigned) stats->rx_bytes,
+               (unsigned) stats->rx_bytes);
+        if (module == NETSTATS_LAYER2) {
+            /* number of messages the packets were passed up with */
+            printf("  messages %u", (unsigned) stats->rx_dispatch_count);
+        }
+        printf("\n"
+               "            TX packets %u (Multicast: %u)  bytes %u\n"
+               "            TX succeeded %u errors %u\n",
                (unsigned) (stats->tx_unicast_count + stats->tx_mcast_count),
                (unsigned) stats->tx_mcast_count,
                (unsigned) stats->tx_bytes,
                (unsigned) stats->tx_success,
                (unsigned) stats->tx_failed);
+        if (module == NETSTATS_IPV6) {
+            /* packets whose transport checksum was left to the device */
+            printf("            Checksum offloaded RX %u TX %u\n",
+                   (unsigned) stats->rx_csum_offload_count,
+                   (unsigned) stats->tx_csum_offload_count);
+        }
         res = 0;
     }
     return res;
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command printing the statistics of MTD page caches
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mtd_cache.h"
+
+int _mtd_cache_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    unsigned num = 0;
+
+    for (mtd_cache_t *cache = mtd_cache_iter(NULL); cache != NULL;
+         cache = mtd_cache_iter(cache)) {
+        mtd_cache_stats_t *stats = &cache->stats;
+        uint32_t accesses = stats->hits + stats->misses;
+        unsigned rate = accesses ? (uint64_t)stats->hits * 100 / accesses : 0;
+
+        printf("cache %u: %" PRIu32 " hits, %" PRIu32 " misses (%u %% hits), "
+               "%" PRIu32 " pages written back, %u dirty\n", num,
+               stats->hits, stats->misses, rate, stats->writebacks,
+               mtd_cache_dirty(cache));
+        num++;
+    }
+    if (num == 0) {
+        puts("no cache initialized");
+    }
+    return 0;
+}
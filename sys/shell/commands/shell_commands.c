@@ -138,6 +138,10 @@ extern int _ccnl_fib(int argc, char **argv);
 extern int _ntpdate(int argc, char **argv);
 #endif
 
+#ifdef MODULE_MTD_CACHE
+extern int _mtd_cache_handler(int argc, char **argv);
+#endif
+
 #ifdef MODULE_VFS
 extern int _vfs_handler(int argc, char **argv);
 extern int _ls_handler(int argc, char **argv);
@@ -274,6 +278,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_SNTP
     { "ntpdate", "synchronizes with a remote time server", _ntpdate },
 #endif
+#ifdef MODULE_MTD_CACHE
+    {"mtd_cache", "MTD page cache statistics", _mtd_cache_handler},
+#endif
 #ifdef MODULE_VFS
     {"vfs", "virtual file system operations", _vfs_handler},
     {"ls", "list files", _ls_handler},
@@ -314,9 +314,20 @@ static int _dtv_verify_image_match(suit_manifest_t *manifest, int key,
      * riotboot_flashwrite_verify_sha256() is only interested in the 32b digest,
      * so shift the pointer accordingly.
      */
-    res = riotboot_flashwrite_verify_sha256(digest + 4,
-                                            manifest->components[0].size,
-                                            target_slot);
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    if (manifest->state & SUIT_MANIFEST_HAVE_IMAGE) {
+        /* the digest was calculated while fetching the image */
+        res = riotboot_flashwrite_verify_sha256_stream(digest + 4,
+                                                       manifest->components[0].size,
+                                                       manifest->writer);
+    }
+    else
+#endif
+    {
+        res = riotboot_flashwrite_verify_sha256(digest + 4,
+                                                manifest->components[0].size,
+                                                target_slot);
+    }
     if (res != 0) {
         return SUIT_ERR_COND;
     }
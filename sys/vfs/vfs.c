@@ -16,6 +16,7 @@
 
 #include <errno.h> /* for error codes */
 #include <string.h> /* for strncmp */
+#include <stdbool.h>
 #include <stddef.h> /* for NULL */
 #include <sys/types.h> /* for off_t etc */
 #include <sys/stat.h> /* for struct stat */
@@ -24,6 +25,9 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "vfs.h"
+#include "assert.h"
+#include "bitarithm.h"
+#include "irq.h"
 #include "mutex.h"
 #include "thread.h"
 #include "kernel_types.h"
@@ -59,6 +63,48 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Number of bits in a word of the _vfs_used_fds bitmap
+ */
+#define FD_WORD_BITS (sizeof(unsigned) * 8)
+
+/**
+ * @internal
+ * @brief Bitmap of the used entries in the _vfs_open_files array
+ *
+ * Bit n is set while fd n is in use, so a free fd is found word by word.
+ */
+static unsigned _vfs_used_fds[(VFS_MAX_OPEN_FILES + FD_WORD_BITS - 1) / FD_WORD_BITS];
+
+/**
+ * @internal
+ * @brief Index of all mounts, hashed by mount point
+ *
+ * Mounts with colliding hashes are chained through vfs_mount_t::hash_next,
+ * the most recent mount first.
+ */
+static vfs_mount_t *_vfs_mount_index[VFS_MOUNT_HASH_BUCKETS];
+
+/**
+ * @internal
+ * @brief Lengths of all mount points
+ *
+ * Bit n is set if a mount point of length n is mounted, the most significant
+ * bit stands for all longer ones. Only prefixes of these lengths need to be
+ * looked up in the index.
+ */
+static uint32_t _vfs_mount_lens;
+
+/**
+ * @internal
+ * @brief Length of the longest mount point
+ */
+static size_t _vfs_mount_len_max;
+
+static_assert((VFS_MOUNT_HASH_BUCKETS & (VFS_MOUNT_HASH_BUCKETS - 1)) == 0,
+              "VFS_MOUNT_HASH_BUCKETS must be a power of 2");
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -67,9 +113,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, the lowest unused slot is taken from the
+ * bitmap of used slots and its number is returned.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -118,6 +163,27 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
  */
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path);
 
+/**
+ * @internal
+ * @brief Get the bit representing a mount point length in _vfs_mount_lens
+ *
+ * @param[in]  len   length of the mount point
+ *
+ * @return bit for @p len
+ */
+static inline uint32_t _mount_len_bit(size_t len);
+
+/**
+ * @internal
+ * @brief Get the bucket of the mount index a mount point belongs to
+ *
+ * @param[in]  path  mount point, does not need to be null-terminated
+ * @param[in]  len   length of the mount point
+ *
+ * @return pointer to the first mount in the bucket
+ */
+static vfs_mount_t **_mount_bucket(const char *path, size_t len);
+
 /**
  * @internal
  * @brief Check that a given fd number is valid
@@ -192,6 +258,21 @@ int vfs_fstat(int fd, struct stat *buf)
     return filp->f_op->fstat(filp, buf);
 }
 
+int vfs_fsync(int fd)
+{
+    DEBUG_NOT_STDOUT(fd, "vfs_fsync: %d\n", fd);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->fsync == NULL) {
+        /* driver does not buffer anything */
+        return 0;
+    }
+    return filp->f_op->fsync(filp);
+}
+
 int vfs_fstatvfs(int fd, struct statvfs *buf)
 {
     DEBUG("vfs_fstatvfs: %d, %p\n", fd, (void *)buf);
@@ -483,6 +564,14 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* insert last in list */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    vfs_mount_t **bucket = _mount_bucket(mountp->mount_point,
+                                         mountp->mount_point_len);
+    mountp->hash_next = *bucket;
+    *bucket = mountp;
+    _vfs_mount_lens |= _mount_len_bit(mountp->mount_point_len);
+    if (mountp->mount_point_len > _vfs_mount_len_max) {
+        _vfs_mount_len_max = mountp->mount_point_len;
+    }
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -529,6 +618,21 @@ int vfs_umount(vfs_mount_t *mountp)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    vfs_mount_t **bucket = _mount_bucket(mountp->mount_point,
+                                         mountp->mount_point_len);
+    while (*bucket != mountp) {
+        bucket = &(*bucket)->hash_next;
+    }
+    *bucket = mountp->hash_next;
+    _vfs_mount_lens = 0;
+    _vfs_mount_len_max = 0;
+    for (const vfs_mount_t *it = vfs_iterate_mounts(NULL); it != NULL;
+         it = vfs_iterate_mounts(it)) {
+        _vfs_mount_lens |= _mount_len_bit(it->mount_point_len);
+        if (it->mount_point_len > _vfs_mount_len_max) {
+            _vfs_mount_len_max = it->mount_point_len;
+        }
+    }
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -867,18 +971,24 @@ const vfs_mount_t *vfs_iterate_mounts(const vfs_mount_t *cur)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_vfs_used_fds); i++) {
+            unsigned unused = ~_vfs_used_fds[i];
+            if (i == 0) {
                 /* Do not auto-allocate the stdio file descriptor numbers to
                  * avoid conflicts between normal file system users and stdio
                  * drivers such as stdio_uart, stdio_rtt which need to be able
                  * to bind to these specific file descriptor numbers. */
-                continue;
+                unused &= ~((1U << STDIN_FILENO) | (1U << STDOUT_FILENO) |
+                            (1U << STDERR_FILENO));
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+            if (unused != 0) {
+                fd = i * FD_WORD_BITS + bitarithm_lsb(unused);
                 break;
             }
         }
+        if (fd < 0) {
+            fd = VFS_MAX_OPEN_FILES;
+        }
     }
     if (fd >= VFS_MAX_OPEN_FILES) {
         /* The _vfs_open_files array is full */
@@ -895,6 +1005,10 @@ static inline int _allocate_fd(int fd)
         pid = -1;
     }
     _vfs_open_files[fd].pid = pid;
+    /* _free_fd() does not hold _open_mutex */
+    unsigned state = irq_disable();
+    _vfs_used_fds[fd / FD_WORD_BITS] |= 1U << (fd % FD_WORD_BITS);
+    irq_restore(state);
     return fd;
 }
 
@@ -905,6 +1019,9 @@ static inline void _free_fd(int fd)
         atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    unsigned state = irq_disable();
+    _vfs_used_fds[fd / FD_WORD_BITS] &= ~(1U << (fd % FD_WORD_BITS));
+    irq_restore(state);
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -922,44 +1039,68 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
+static inline uint32_t _hash_step(uint32_t hash, char c)
+{
+    /* FNV-1a */
+    return (hash ^ (uint8_t)c) * 16777619U;
+}
+
+static inline uint32_t _mount_len_bit(size_t len)
+{
+    return 1UL << ((len < 31) ? len : 31);
+}
+
+static vfs_mount_t **_mount_bucket(const char *path, size_t len)
+{
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = _hash_step(hash, path[i]);
+    }
+    return &_vfs_mount_index[hash & (VFS_MOUNT_HASH_BUCKETS - 1)];
+}
+
+static vfs_mount_t *_lookup_mount(const char *path, size_t len, uint32_t hash)
+{
+    vfs_mount_t *it = _vfs_mount_index[hash & (VFS_MOUNT_HASH_BUCKETS - 1)];
+
+    for (; it != NULL; it = it->hash_next) {
+        if ((it->mount_point_len == len) &&
+            (strncmp(path, it->mount_point, len) == 0)) {
+            return it;
+        }
+    }
+    return NULL;
+}
+
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
 {
     size_t longest_match = 0;
-    size_t name_len = strlen(name);
+    uint32_t hash = 2166136261U;
+    vfs_mount_t *mountp = NULL;
     mutex_lock(&_mount_mutex);
 
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
-    }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
-        }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
-        }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
-            /* special check for mount_point == "/" */
-            if (len > 1) {
-                longest_match = len;
+    /* Every prefix of name that ends at a directory separator or at the end
+     * of name may be a mount point, the longest one mounted wins. Each of
+     * them with the length of a mount point is looked up in the index while
+     * hashing name. */
+    for (size_t len = 0; len <= _vfs_mount_len_max; len++) {
+        /* "/" is the only mount point not followed by a separator */
+        bool boundary = (len == 1) ||
+                        ((len > 1) && ((name[len] == '/') || (name[len] == '\0')));
+        if (boundary && (_vfs_mount_lens & _mount_len_bit(len))) {
+            vfs_mount_t *it = _lookup_mount(name, len, hash);
+            if (it != NULL) {
+                mountp = it;
+                /* the path relative to "/" keeps the leading slash */
+                longest_match = (len > 1) ? len : 0;
             }
-            mountp = it;
         }
-    } while (node != _vfs_mounts_list.next);
+        if (name[len] == '\0') {
+            break;
+        }
+        hash = _hash_step(hash, name[len]);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
@@ -23,6 +23,7 @@
  * @}
  */
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "kernel_defines.h"
@@ -31,11 +32,15 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#ifdef MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t *next);
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
@@ -49,12 +54,40 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#ifdef MODULE_ZTIMER_WHEEL
+    (void)clock;
+    return (t->base.pprev != NULL);
+#else
     if (!clock->list.next) {
         return 0;
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
+#endif
+}
+
+static inline bool _is_empty(const ztimer_clock_t *clock)
+{
+#ifdef MODULE_ZTIMER_WHEEL
+    return ztimer_wheel_is_empty(clock);
+#else
+    return (clock->list.next == NULL);
+#endif
+}
+
+/* gets the ticks from the clock's base time to its next event */
+static bool _get_next(const ztimer_clock_t *clock, uint32_t *offset)
+{
+#ifdef MODULE_ZTIMER_WHEEL
+    return ztimer_wheel_next(clock, offset);
+#else
+    if (clock->list.next) {
+        *offset = clock->list.next->offset;
+        return true;
+    }
+    return false;
+#endif
 }
 
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
@@ -92,8 +125,7 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    if (_add_entry_to_list(clock, &timer->base, &val)) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -106,20 +138,30 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     irq_restore(state);
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+/* returns true and the new offset of the next event, if entry changed it */
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t *next)
 {
-    uint32_t delta_sum = 0;
-
-    ztimer_base_t *list = &clock->list;
-
 #ifdef MODULE_PM_LAYERED
     /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    if (_is_empty(clock) &&
         clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->required_pm_mode);
     }
 #endif
 
+#ifdef MODULE_ZTIMER_WHEEL
+    uint32_t before;
+    bool armed = ztimer_wheel_next(clock, &before);
+
+    ztimer_wheel_add(clock, entry);
+    ztimer_wheel_next(clock, next);
+    return !armed || (*next < before);
+#else
+    uint32_t delta_sum = 0;
+
+    ztimer_base_t *list = &clock->list;
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -143,6 +185,9 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
+    *next = entry->offset;
+    return (clock->list.next == entry);
+#endif
 }
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
@@ -175,6 +220,9 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 
 void ztimer_update_head_offset(ztimer_clock_t *clock)
 {
+#ifdef MODULE_ZTIMER_WHEEL
+    ztimer_wheel_advance(clock, ztimer_now(clock));
+#else
     uint32_t old_base = clock->list.offset;
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
@@ -213,6 +261,7 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
     }
 
     clock->list.offset = now;
+#endif
 }
 
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
@@ -222,6 +271,10 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#ifdef MODULE_ZTIMER_WHEEL
+    (void)list;
+    ztimer_wheel_del(clock, entry);
+#else
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -243,10 +296,11 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         }
         list = list->next;
     }
+#endif
 
 #ifdef MODULE_PM_LAYERED
     /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    if (_is_empty(clock) &&
         clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->required_pm_mode);
     }
@@ -255,6 +309,18 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#ifdef MODULE_ZTIMER_WHEEL
+    ztimer_base_t *entry = ztimer_wheel_pop(clock);
+
+#ifdef MODULE_PM_LAYERED
+    if (entry && ztimer_wheel_is_empty(clock) &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        /* The last timer just got removed from the clock */
+        pm_unblock(clock->required_pm_mode);
+    }
+#endif
+    return (ztimer_t *)entry;
+#else
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -273,16 +339,18 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     else {
         return NULL;
     }
+#endif
 }
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t next;
+    bool armed = _get_next(clock, &next);
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (armed) {
+            clock->ops->set(clock, _min_u32(next, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -292,8 +360,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (armed) {
+            clock->ops->set(clock, next);
         }
         else {
             clock->ops->cancel(clock);
@@ -309,6 +377,11 @@ void ztimer_handler(ztimer_clock_t *clock)
         _ztimer_print(clock);
     }
 
+#ifdef MODULE_ZTIMER_WHEEL
+    /* moves all expired timers to the clock's list, calling now also
+     * triggers checkpointing */
+    ztimer_update_head_offset(clock);
+#else
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
     if (IS_USED(MODULE_ZTIMER_NOW64) || clock->max_value < UINT32_MAX) {
         /* calling now triggers checkpointing */
@@ -341,6 +414,7 @@ void ztimer_handler(ztimer_clock_t *clock)
 
     clock->list.offset += clock->list.next->offset;
     clock->list.next->offset = 0;
+#endif
 
     ztimer_t *entry = _now_next(clock);
     while (entry) {
@@ -369,6 +443,14 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#ifdef MODULE_ZTIMER_WHEEL
+    printf("base %" PRIu32 " expired %p", clock->list.offset,
+           (void *)clock->list.next);
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        printf(" %u:0x%08" PRIx32, level, clock->wheel.used[level]);
+    }
+    printf(" wrapped %p\n", (void *)clock->wheel.wrapped);
+#else
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
@@ -381,4 +463,5 @@ static void _ztimer_print(const ztimer_clock_t *clock)
 
     } while ((entry = entry->next));
     puts("");
+#endif
 }
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel
+ *
+ * All timers of a level have the same bits above that level in their target
+ * as the base time of the clock (ztimer_clock_t::list::offset) and a larger
+ * slot index than the base time. So the first non-empty slot of the lowest
+ * non-empty level always holds the next timer to expire. For level 0 this
+ * is the exact target, for the upper levels it is the start of the slot,
+ * where its timers are re-inserted relative to the advanced base time.
+ *
+ * Expired timers are kept in ztimer_clock_t::list in the order they expired,
+ * with ztimer_clock_t::last pointing to the tail of that list.
+ *
+ * @}
+ */
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define SLOT_BITS       CONFIG_ZTIMER_WHEEL_SLOT_BITS
+
+/* pseudo level for the list of wrapped around timers */
+#define LEVEL_WRAPPED   ZTIMER_WHEEL_LEVELS
+
+static_assert((SLOT_BITS >= 1) && (SLOT_BITS <= 5),
+              "CONFIG_ZTIMER_WHEEL_SLOT_BITS must be between 1 and 5");
+
+static inline unsigned _msb(uint32_t val)
+{
+    return (8 * sizeof(unsigned long) - 1) - __builtin_clzl(val);
+}
+
+static inline unsigned _lsb(uint32_t val)
+{
+    return __builtin_ctzl(val);
+}
+
+static void _push(ztimer_base_t **head, ztimer_base_t *entry)
+{
+    entry->next = *head;
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = head;
+    *head = entry;
+}
+
+static void _append_expired(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t **tail = (clock->last) ? &clock->last->next
+                                         : &clock->list.next;
+
+    entry->next = NULL;
+    entry->pprev = tail;
+    *tail = entry;
+    clock->last = entry;
+}
+
+static void _insert(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t base = clock->list.offset;
+    uint32_t target = entry->offset;
+
+    if (target == base) {
+        _append_expired(clock, entry);
+    }
+    else if (target < base) {
+        /* target is behind the wrap-around of the 32 bit base time */
+        _push(&wheel->wrapped, entry);
+    }
+    else {
+        unsigned level = _msb(target ^ base) / SLOT_BITS;
+        unsigned slot = (target >> (level * SLOT_BITS)) &
+                        (ZTIMER_WHEEL_SLOTS - 1);
+
+        DEBUG("ztimer_wheel: %p target %" PRIu32 " at level %u slot %u\n",
+              (void *)entry, target, level, slot);
+        _push(&wheel->slot[level][slot], entry);
+        wheel->used[level] |= (uint32_t)1 << slot;
+    }
+}
+
+/* returns the level of the next event or -1 if there is none */
+static int _next_event(const ztimer_clock_t *clock, uint32_t *offset,
+                       unsigned *slot)
+{
+    const ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t base = clock->list.offset;
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->used[level]) {
+            unsigned shift = level * SLOT_BITS;
+            unsigned upper = shift + SLOT_BITS;
+            uint32_t start;
+
+            *slot = _lsb(wheel->used[level]);
+            start = (uint32_t)*slot << shift;
+            if (upper < 32) {
+                start |= (base >> upper) << upper;
+            }
+            *offset = start - base;
+            return level;
+        }
+    }
+    if (wheel->wrapped) {
+        *offset = 0 - base;
+        return LEVEL_WRAPPED;
+    }
+    return -1;
+}
+
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    assert(entry->pprev == NULL);
+    entry->offset += clock->list.offset;
+    _insert(clock, entry);
+}
+
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    ztimer_base_t **pprev = entry->pprev;
+
+    assert(pprev != NULL);
+    if (entry == clock->last) {
+        clock->last = (pprev == &clock->list.next)
+                    ? NULL : container_of(pprev, ztimer_base_t, next);
+    }
+    *pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = pprev;
+    }
+    else {
+        uintptr_t first = (uintptr_t)&wheel->slot[0][0];
+        uintptr_t pos = (uintptr_t)pprev;
+
+        if ((pos >= first) && (pos < (first + sizeof(wheel->slot)))) {
+            /* entry was the only timer in its slot */
+            unsigned idx = (pos - first) / sizeof(wheel->slot[0][0]);
+
+            wheel->used[idx / ZTIMER_WHEEL_SLOTS] &=
+                ~((uint32_t)1 << (idx % ZTIMER_WHEEL_SLOTS));
+        }
+    }
+    /* reset the entry's pprev pointer so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t elapsed = now - clock->list.offset;
+    uint32_t offset;
+    unsigned slot;
+    int level;
+
+    while (((level = _next_event(clock, &offset, &slot)) >= 0) &&
+           (offset <= elapsed)) {
+        ztimer_base_t *entry;
+
+        clock->list.offset += offset;
+        elapsed -= offset;
+        if (level == LEVEL_WRAPPED) {
+            entry = wheel->wrapped;
+            wheel->wrapped = NULL;
+        }
+        else {
+            entry = wheel->slot[level][slot];
+            wheel->slot[level][slot] = NULL;
+            wheel->used[level] &= ~((uint32_t)1 << slot);
+        }
+        DEBUG("ztimer_wheel: cascading level %d at %" PRIu32 "\n", level,
+              clock->list.offset);
+        /* level 0 timers expire now, all others move to a lower level */
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            _insert(clock, entry);
+            entry = next;
+        }
+    }
+    clock->list.offset = now;
+}
+
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    unsigned slot;
+
+    if (clock->list.next) {
+        *offset = 0;
+        return true;
+    }
+    return _next_event(clock, offset, &slot) >= 0;
+}
+
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->list.next;
+
+    if (entry) {
+        ztimer_wheel_del(clock, entry);
+    }
+    return entry;
+}
+
+bool ztimer_wheel_is_empty(const ztimer_clock_t *clock)
+{
+    if (clock->list.next || clock->wheel.wrapped) {
+        return false;
+    }
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (clock->wheel.used[level]) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for dispatching received frames in the CAN router
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "can/common.h"
+#include "can/dll.h"
+#include "can/pkt.h"
+#include "can/raw.h"
+#include "can/router.h"
+#include "kernel_defines.h"
+#include "msg.h"
+#include "thread.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define IFNUM               (0)
+#define BASE_ID             (0x100U)
+#define RANGE_ID            (0x700U)
+#define MSG_QUEUE_SIZE      (4U)
+
+static const unsigned _filter_steps[] = { 1, 16, 64, 256 };
+static unsigned _filters_numof = 0;
+static unsigned _errors = 0;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static can_reg_entry_t _entry;
+
+static int _add_filters(unsigned num)
+{
+    for (; _filters_numof < num; _filters_numof++) {
+        if (can_router_register(&_entry, BASE_ID + _filters_numof,
+                                CAN_SFF_MASK, NULL) < 0) {
+            printf("Unable to add filter %u\n", _filters_numof);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _dispatch(unsigned i)
+{
+    struct can_frame frame = {
+        /* spread frames over all filters */
+        .can_id = BASE_ID + ((i * 7919) % _filters_numof),
+        .can_dlc = 0,
+    };
+    can_pkt_t *pkt = can_pkt_alloc_rx(IFNUM, &frame);
+    msg_t msg;
+
+    if ((pkt == NULL) || (can_router_dispatch_rx_indic(pkt) < 0) ||
+        (msg_try_receive(&msg) < 0) || (msg.type != CAN_MSG_RX_INDICATION)) {
+        _errors++;
+        return;
+    }
+    raw_can_free_frame(msg.content.ptr);
+}
+
+int main(void)
+{
+    printf("CAN router filter look-up: %s\n",
+           (CAN_ROUTER_MASK_CLASSES > 0) ? "hash" : "linear");
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    can_dll_init();
+    _entry.ifnum = IFNUM;
+    _entry.target.pid = thread_getpid();
+#ifdef MODULE_CAN_MBOX
+    _entry.type = CAN_TYPE_DEFAULT;
+#endif
+
+    for (unsigned step = 0; step < ARRAY_SIZE(_filter_steps); step++) {
+        char name[24];
+
+        if (_add_filters(_filter_steps[step]) < 0) {
+            puts("[FAILED]");
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%u filters", _filters_numof);
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        BENCHMARK_FUNC(name, BENCH_RUNS, _dispatch(i));
+    }
+
+    /* a filter for a range of identifiers is always matched linearly */
+    if (can_router_register(&_entry, RANGE_ID, RANGE_ID, NULL) < 0) {
+        puts("Unable to add range filter");
+        puts("[FAILED]");
+        return 1;
+    }
+    BENCHMARK_FUNC("256 filters + range", BENCH_RUNS, _dispatch(i));
+
+    if (_errors > 0) {
+        printf("%u frames were not dispatched\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
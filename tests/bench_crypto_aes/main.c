@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of AES-128 in the different cipher modes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "xtimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100U)
+#endif
+
+#define BUF_SIZE            (1024U)
+#define CCM_MAC_LEN         (8U)
+#define CCM_LEN_ENCODING    (2U)
+#define CCM_NONCE_LEN       (13U)
+
+enum {
+    MODE_BLOCK,
+    MODE_ECB,
+    MODE_CBC_ENC,
+    MODE_CBC_DEC,
+    MODE_CTR,
+    MODE_CCM_ENC,
+    MODE_CCM_DEC,
+    MODE_NUMOF,
+};
+
+static const char *_names[] = {
+    [MODE_BLOCK] = "single blocks",
+    [MODE_ECB] = "ECB",
+    [MODE_CBC_ENC] = "CBC encrypt",
+    [MODE_CBC_DEC] = "CBC decrypt",
+    [MODE_CTR] = "CTR",
+    [MODE_CCM_ENC] = "CCM encrypt",
+    [MODE_CCM_DEC] = "CCM decrypt",
+};
+
+static const uint8_t _key[AES_KEY_SIZE] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+static const uint8_t _nonce[CCM_NONCE_LEN] = { 0 };
+static uint8_t _in[BUF_SIZE];
+static uint8_t _out[BUF_SIZE + CCM_MAC_LEN];
+static uint8_t _ccm[BUF_SIZE + CCM_MAC_LEN];
+static cipher_t _cipher;
+
+static int _run(unsigned mode)
+{
+    uint8_t iv[16] = { 0 };
+
+    switch (mode) {
+        case MODE_BLOCK:
+            for (unsigned i = 0; i < BUF_SIZE; i += AES_BLOCK_SIZE) {
+                if (cipher_encrypt(&_cipher, &_in[i], &_out[i]) != 1) {
+                    return -1;
+                }
+            }
+            return BUF_SIZE;
+        case MODE_ECB:
+            return cipher_encrypt_ecb(&_cipher, _in, BUF_SIZE, _out);
+        case MODE_CBC_ENC:
+            return cipher_encrypt_cbc(&_cipher, iv, _in, BUF_SIZE, _out);
+        case MODE_CBC_DEC:
+            return cipher_decrypt_cbc(&_cipher, iv, _in, BUF_SIZE, _out);
+        case MODE_CTR:
+            return cipher_encrypt_ctr(&_cipher, iv, 8, _in, BUF_SIZE, _out);
+        case MODE_CCM_ENC:
+            return cipher_encrypt_ccm(&_cipher, NULL, 0, CCM_MAC_LEN,
+                                      CCM_LEN_ENCODING, _nonce, CCM_NONCE_LEN,
+                                      _in, BUF_SIZE, _out);
+        case MODE_CCM_DEC:
+            return cipher_decrypt_ccm(&_cipher, NULL, 0, CCM_MAC_LEN,
+                                      CCM_LEN_ENCODING, _nonce, CCM_NONCE_LEN,
+                                      _ccm, sizeof(_ccm), _out);
+        default:
+            return -1;
+    }
+}
+
+int main(void)
+{
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+    if ((cipher_init(&_cipher, CIPHER_AES_128, _key, AES_KEY_SIZE) != 1) ||
+        (cipher_encrypt_ccm(&_cipher, NULL, 0, CCM_MAC_LEN, CCM_LEN_ENCODING,
+                            _nonce, CCM_NONCE_LEN, _in, BUF_SIZE,
+                            _ccm) != (int)sizeof(_ccm))) {
+        puts("setup failed");
+        puts("[FAILED]");
+        return 1;
+    }
+    printf("%u runs over %u bytes\n", BENCH_RUNS, BUF_SIZE);
+    for (unsigned mode = 0; mode < MODE_NUMOF; mode++) {
+        uint32_t start, usec;
+        uint64_t bytes = 0;
+
+        start = xtimer_now_usec();
+        for (unsigned run = 0; run < BENCH_RUNS; run++) {
+            int res = _run(mode);
+
+            if (res < 0) {
+                printf("%s failed: %d\n", _names[mode], res);
+                errors++;
+                break;
+            }
+            bytes += BUF_SIZE;
+        }
+        usec = xtimer_now_usec() - start;
+        if (usec == 0) {
+            usec = 1;
+        }
+        /* bytes per microsecond are MB/s */
+        uint32_t mbps_milli = (bytes * 1000) / usec;
+        printf("%s: %" PRIu32 ".%03" PRIu32 " MB/s\n", _names[mode],
+               mbps_milli / 1000, mbps_milli % 1000);
+    }
+    if (errors > 0) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 120
+MODES = ("single blocks", "ECB", "CBC encrypt", "CBC decrypt", "CTR",
+         "CCM encrypt", "CCM decrypt")
+
+
+def testfunc(child):
+    for mode in MODES:
+        child.expect(r"{}: \d+\.\d+ MB/s".format(mode), timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
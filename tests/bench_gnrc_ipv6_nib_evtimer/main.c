@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the event timer of the GNRC IPv6 NIB
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define NBRS_NUMOF          (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#define IFACE               (6U)
+/* far enough in the future to never fire during the benchmark */
+#define TIMEOUT_BASE_MS     (3600UL * MS_PER_SEC)
+
+static const unsigned _nbr_steps[] = { 16, 128, 512 };
+static _nib_onl_entry_t *_nbrs[NBRS_NUMOF];
+static unsigned _nbrs_numof = 0;
+static unsigned _errors = 0;
+/* moves the timeouts further into the future on every reschedule */
+static uint32_t _extension = 0;
+
+static void _schedule(_nib_onl_entry_t *nbr, uint32_t offset)
+{
+    _evtimer_add_until(nbr, GNRC_IPV6_NIB_SND_MC_NS, &nbr->nud_timeout,
+                       &nbr->nud_timeout_until, offset);
+}
+
+static int _add_nbrs(unsigned num)
+{
+    for (; _nbrs_numof < num; _nbrs_numof++) {
+        ipv6_addr_t addr;
+        _nib_onl_entry_t *nbr;
+
+        ipv6_addr_from_str(&addr, "fe80::");
+        addr.u16[6] = byteorder_htons(_nbrs_numof >> 16);
+        addr.u16[7] = byteorder_htons(_nbrs_numof & 0xffff);
+        if ((nbr = _nib_nc_add(&addr, IFACE,
+                               GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)) == NULL) {
+            printf("Unable to add neighbor %u\n", _nbrs_numof);
+            return -1;
+        }
+        _nbrs[_nbrs_numof] = nbr;
+        _schedule(nbr, TIMEOUT_BASE_MS + _nbrs_numof);
+    }
+    return 0;
+}
+
+static void _lookup(unsigned i)
+{
+    _nib_onl_entry_t *nbr = _nbrs[(i * 7919) % _nbrs_numof];
+
+    if (_evtimer_lookup(&nbr->nud_timeout, nbr->nud_timeout_until,
+                        GNRC_IPV6_NIB_SND_MC_NS) == UINT32_MAX) {
+        _errors++;
+    }
+}
+
+static void _reschedule(unsigned i)
+{
+    _schedule(_nbrs[(i * 7919) % _nbrs_numof], TIMEOUT_BASE_MS + ++_extension);
+}
+
+static void _cancel(unsigned i)
+{
+    _nib_onl_entry_t *nbr = _nbrs[(i * 7919) % _nbrs_numof];
+
+    _evtimer_cancel(&nbr->nud_timeout);
+    if (_evtimer_lookup(&nbr->nud_timeout, nbr->nud_timeout_until,
+                        GNRC_IPV6_NIB_SND_MC_NS) != UINT32_MAX) {
+        _errors++;
+    }
+    _schedule(nbr, TIMEOUT_BASE_MS + ++_extension);
+}
+
+int main(void)
+{
+    gnrc_ipv6_nib_init();
+    _nib_acquire();
+    for (unsigned step = 0; step < ARRAY_SIZE(_nbr_steps); step++) {
+        char name[32];
+
+        if ((_nbr_steps[step] > NBRS_NUMOF) ||
+            (_add_nbrs(_nbr_steps[step]) < 0)) {
+            _nib_release();
+            puts("[FAILED]");
+            return 1;
+        }
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        snprintf(name, sizeof(name), "lookup %u", _nbrs_numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _lookup(i));
+        snprintf(name, sizeof(name), "reschedule %u", _nbrs_numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _reschedule(i));
+        snprintf(name, sizeof(name), "cancel %u", _nbrs_numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _cancel(i));
+    }
+    _nib_release();
+    if (_errors > 0) {
+        printf("%u look-ups returned the wrong state\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
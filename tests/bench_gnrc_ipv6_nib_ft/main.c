@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the route look-up in the GNRC IPv6 NIB
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define ROUTES_NUMOF        (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+#define NEXT_HOPS_NUMOF     (4U)
+#define IFACE               (6U)
+
+static const unsigned _route_steps[] = { 16, 256, 1024 };
+static ipv6_addr_t _dsts[ROUTES_NUMOF];
+static uint8_t _dst_lens[ROUTES_NUMOF];
+static unsigned _routes = 0;
+static unsigned _errors = 0;
+
+/* route i is 2001:db8:i:<scrambled i>::/(48 + (i % 17)) */
+static unsigned _route(unsigned i, ipv6_addr_t *pfx)
+{
+    ipv6_addr_from_str(pfx, "2001:db8::");
+    pfx->u16[2] = byteorder_htons(i);
+    pfx->u16[3] = byteorder_htons((i * 0x9e37) & 0xffff);
+    return 48 + (i % 17);
+}
+
+static int _add_routes(unsigned num)
+{
+    ipv6_addr_t next_hop;
+
+    ipv6_addr_from_str(&next_hop, "fe80::1");
+    for (; _routes < num; _routes++) {
+        ipv6_addr_t pfx;
+        unsigned pfx_len = _route(_routes, &pfx);
+        int res;
+
+        next_hop.u8[15] = 1 + (_routes % NEXT_HOPS_NUMOF);
+        if ((res = gnrc_ipv6_nib_ft_add(&pfx, pfx_len, &next_hop, IFACE,
+                                        0)) < 0) {
+            printf("Unable to add route %u: %d\n", _routes, res);
+            return res;
+        }
+        /* destination within the route just added */
+        memcpy(&_dsts[_routes], &pfx, sizeof(pfx));
+        _dsts[_routes].u8[15] = 1;
+        _dst_lens[_routes] = pfx_len;
+    }
+    return 0;
+}
+
+static void _lookup(unsigned i)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    /* spread look-ups over all routes */
+    unsigned idx = (i * 7919) % _routes;
+
+    if ((gnrc_ipv6_nib_ft_get(&_dsts[idx], NULL, &fte) < 0) ||
+        (fte.dst_len != _dst_lens[idx])) {
+        _errors++;
+    }
+}
+
+int main(void)
+{
+    printf("Off-link entry look-up: %s\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) ? "trie" : "linear");
+
+    for (unsigned step = 0; step < ARRAY_SIZE(_route_steps); step++) {
+        char name[16];
+
+        if ((_route_steps[step] > ROUTES_NUMOF) ||
+            (_add_routes(_route_steps[step]) < 0)) {
+            puts("[FAILED]");
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%u routes", _routes);
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        BENCHMARK_FUNC(name, BENCH_RUNS, _lookup(i));
+    }
+    if (_errors > 0) {
+        printf("%u look-ups returned the wrong route\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 30
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect(r"Off-link entry look-up: (trie|linear)")
+    for routes in (16, 256, 1024):
+        child.expect(BENCHMARK_REGEXP.format(func="{} routes".format(routes)),
+                     timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the neighbor look-up in the GNRC IPv6 NIB
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define NBRS_NUMOF          (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#define IFACE               (6U)
+
+static const unsigned _nbr_steps[] = { 16, 256, 2048 };
+static unsigned _nbrs_numof = 0;
+static unsigned _errors = 0;
+
+/* neighbor i is fe80::<scrambled i>:i */
+static void _nbr(unsigned i, ipv6_addr_t *addr)
+{
+    ipv6_addr_from_str(addr, "fe80::");
+    addr->u16[6] = byteorder_htons((i * 0x9e37) & 0xffff);
+    addr->u16[7] = byteorder_htons(i);
+}
+
+static _nib_onl_entry_t *_add(unsigned i)
+{
+    ipv6_addr_t addr;
+    _nib_onl_entry_t *nbr;
+
+    _nbr(i, &addr);
+    nbr = _nib_nc_add(&addr, IFACE, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
+    if (nbr != NULL) {
+        /* make entry replaceable once the neighbor cache is full */
+        nbr->info &= ~GNRC_IPV6_NIB_NC_INFO_AR_STATE_MASK;
+        nbr->info |= GNRC_IPV6_NIB_NC_INFO_AR_STATE_GC;
+    }
+    return nbr;
+}
+
+static int _add_nbrs(unsigned num)
+{
+    for (; _nbrs_numof < num; _nbrs_numof++) {
+        if (_add(_nbrs_numof) == NULL) {
+            printf("Unable to add neighbor %u\n", _nbrs_numof);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _lookup(unsigned i)
+{
+    ipv6_addr_t addr;
+
+    /* spread look-ups over all neighbors */
+    _nbr((i * 7919) % _nbrs_numof, &addr);
+    if (_nib_onl_get(&addr, IFACE) == NULL) {
+        _errors++;
+    }
+}
+
+static void _replace(unsigned i)
+{
+    /* neighbors not yet in the neighbor cache */
+    if (_add(NBRS_NUMOF + i) == NULL) {
+        _errors++;
+    }
+}
+
+int main(void)
+{
+    printf("On-link entry look-up: %s\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) ? "hash" : "linear");
+
+    gnrc_ipv6_nib_init();
+    _nib_acquire();
+    for (unsigned step = 0; step < ARRAY_SIZE(_nbr_steps); step++) {
+        char name[16];
+
+        if ((_nbr_steps[step] > NBRS_NUMOF) ||
+            (_add_nbrs(_nbr_steps[step]) < 0)) {
+            _nib_release();
+            puts("[FAILED]");
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%u neighbors", _nbrs_numof);
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        BENCHMARK_FUNC(name, BENCH_RUNS, _lookup(i));
+    }
+    BENCHMARK_FUNC("replace", BENCH_RUNS, _replace(i));
+    _nib_release();
+    if (_errors > 0) {
+        printf("%u neighbor cache operations failed\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
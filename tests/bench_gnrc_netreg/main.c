@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the demultiplexing of received packets in GNRC
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define PORTS_NUMOF         (256U)
+#define PORT_BASE           (5683U)
+
+static const unsigned _port_steps[] = { 4, 16, 64, 256 };
+static gnrc_netreg_entry_t _entries[PORTS_NUMOF];
+static unsigned _ports = 0;
+static unsigned long _received = 0;
+static gnrc_pktsnip_t *_pkt;
+
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    /* the packet is dispatched again, so it is not released here */
+    (void)cmd;
+    (void)ctx;
+    if (pkt == _pkt) {
+        _received++;
+    }
+}
+
+static gnrc_netreg_entry_cbd_t _cbd = { .cb = _recv };
+
+static void _add_ports(unsigned num)
+{
+    for (; _ports < num; _ports++) {
+        gnrc_netreg_entry_init_cb(&_entries[_ports], PORT_BASE + _ports,
+                                  &_cbd);
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[_ports]);
+    }
+}
+
+static void _dispatch(unsigned i)
+{
+    /* spread packets over all registered ports */
+    unsigned port = PORT_BASE + ((i * 7919) % _ports);
+
+    gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, _pkt);
+}
+
+int main(void)
+{
+    unsigned long dispatched = 0;
+
+    printf("Demultiplexing: %s\n",
+           IS_USED(MODULE_GNRC_NETREG_HASH) ? "hash table" : "linear");
+
+    _pkt = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_UDP);
+    if (_pkt == NULL) {
+        puts("Unable to allocate packet");
+        puts("[FAILED]");
+        return 1;
+    }
+    for (unsigned step = 0; step < ARRAY_SIZE(_port_steps); step++) {
+        char name[24];
+
+        _add_ports(_port_steps[step]);
+        snprintf(name, sizeof(name), "%u registrations", _ports);
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        BENCHMARK_FUNC(name, BENCH_RUNS, _dispatch(i));
+        dispatched += BENCH_RUNS;
+    }
+    gnrc_pktbuf_release(_pkt);
+    if (_received != dispatched) {
+        printf("%lu of %lu packets were not received\n",
+               dispatched - _received, dispatched);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
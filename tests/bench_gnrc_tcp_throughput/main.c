@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer throughput of GNRC TCP
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+
+/* large enough to fill the whole retransmit queue with one call */
+#define CHUNK_SIZE          (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE * CONFIG_GNRC_TCP_MSS)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _chunk[CHUNK_SIZE];
+
+static int _bench_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t total, sent = 0, start, duration;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%iface]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("bench: invalid endpoint");
+        return 1;
+    }
+    total = strtoul(argv[2], NULL, 10);
+    for (unsigned i = 0; i < sizeof(_chunk); i++) {
+        _chunk[i] = '0' + (i % 10);
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open_active(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("bench: gnrc_tcp_open_active() failed: %d\n", res);
+        return 1;
+    }
+    start = xtimer_now_usec();
+    while (sent < total) {
+        uint32_t len = total - sent;
+
+        res = gnrc_tcp_send(&_tcb, _chunk, (len < CHUNK_SIZE) ? len : CHUNK_SIZE, 0);
+        if (res < 0) {
+            printf("bench: gnrc_tcp_send() failed: %d\n", res);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += res;
+    }
+    duration = xtimer_now_usec() - start;
+    gnrc_tcp_close(&_tcb);
+
+    printf("bench: sent %" PRIu32 " bytes in %" PRIu32 " us (%" PRIu32 " bytes/s), "
+           "%u segments in flight, SACK %s\n", sent, duration,
+           (uint32_t)(((uint64_t)sent * US_PER_SEC) / (duration ? duration : 1)),
+           (unsigned)CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           IS_USED(MODULE_GNRC_TCP_SACK) ? "on" : "off");
+    return 0;
+}
+
+static const shell_command_t _shell_commands[] = {
+    { "bench", "send bytes to a TCP server and measure throughput", _bench_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC TCP throughput benchmark");
+    shell_run(_shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import random
+import re
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+
+TOTAL_BYTES = 1024 * 1024
+TIMEOUT = 120
+
+
+def tcp_server(sock, result):
+    conn, _ = sock.accept()
+    received = 0
+    while True:
+        data = conn.recv(65536)
+        if not data:
+            break
+        received += len(data)
+    conn.close()
+    result.append(received)
+
+
+def get_host_ll_addr(interface):
+    # use the bridge, if the tap device is part of one
+    result = os.popen('bridge link show dev {}'.format(interface))
+    bridge = re.search('master (.*) state', result.read())
+    if bridge:
+        interface = bridge.group(1).strip()
+    result = os.popen('ip addr show dev ' + interface + ' scope link')
+    return re.search('inet6 (.*)/64', result.read()).group(1).strip()
+
+
+def get_riot_if_id(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1).strip()
+
+
+def testfunc(child):
+    port = random.randint(1024, 65535)
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(('::', port))
+    sock.listen(1)
+    result = []
+    server = threading.Thread(target=tcp_server, args=(sock, result))
+    server.start()
+
+    addr = get_host_ll_addr(os.environ["TAPDEV"]) + '%' + get_riot_if_id(child)
+    child.sendline('bench [{}]:{} {}'.format(addr, port, TOTAL_BYTES))
+    child.expect(r'bench: sent (\d+) bytes in \d+ us \((\d+) bytes/s\)',
+                 timeout=TIMEOUT)
+    assert int(child.match.group(1)) == TOTAL_BYTES
+    print('\nThroughput: {} bytes/s'.format(child.match.group(2)))
+
+    server.join()
+    sock.close()
+    assert result == [TOTAL_BYTES]
+    print("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of SHA-256 over a 1 MiB image
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "xtimer.h"
+
+#define IMAGE_SIZE          (1024UL * 1024UL)
+#define BUF_SIZE            (4096U)
+
+/* SHA-256 of the image, i.e. of the bytes (i & 0xff) for i < IMAGE_SIZE */
+static const uint8_t _expected[SHA256_DIGEST_LENGTH] = {
+    0xfb, 0xba, 0xb2, 0x89, 0xf7, 0xf9, 0x4b, 0x25,
+    0x73, 0x6c, 0x58, 0xbe, 0x46, 0xa9, 0x94, 0xc4,
+    0x41, 0xfd, 0x02, 0x55, 0x2c, 0xc6, 0x02, 0x23,
+    0x52, 0xe3, 0xd8, 0x6d, 0x2f, 0xab, 0x7c, 0x83,
+};
+static const unsigned _chunks[] = { BUF_SIZE, 100 };
+static uint8_t _buf[BUF_SIZE];
+
+static int _run(unsigned chunk)
+{
+    sha256_context_t ctx;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint32_t pos = 0;
+
+    sha256_init(&ctx);
+    while (pos < IMAGE_SIZE) {
+        /* _buf holds the image at any offset that is a multiple of 256 */
+        unsigned off = pos % 256;
+        uint32_t len = chunk;
+
+        if (len > IMAGE_SIZE - pos) {
+            len = IMAGE_SIZE - pos;
+        }
+        sha256_update(&ctx, &_buf[off], len);
+        pos += len;
+    }
+    sha256_final(&ctx, digest);
+    return memcmp(digest, _expected, sizeof(digest)) == 0 ? 0 : -1;
+}
+
+int main(void)
+{
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i;
+    }
+    printf("hashing %lu bytes\n", IMAGE_SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        uint32_t start, usec;
+
+        start = xtimer_now_usec();
+        int res = _run(_chunks[i]);
+        usec = xtimer_now_usec() - start;
+        if (res < 0) {
+            printf("%u byte chunks: wrong digest\n", _chunks[i]);
+            errors++;
+            continue;
+        }
+        if (usec == 0) {
+            usec = 1;
+        }
+        /* bytes per microsecond are MB/s */
+        uint32_t mbps_milli = ((uint64_t)IMAGE_SIZE * 1000) / usec;
+        printf("%u byte chunks: %" PRIu32 ".%03" PRIu32 " MB/s\n", _chunks[i],
+               mbps_milli / 1000, mbps_milli % 1000);
+    }
+    if (errors > 0) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
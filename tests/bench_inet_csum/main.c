@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Differential test and benchmark for the Internet checksum
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef FUZZ_RUNS
+#define FUZZ_RUNS           (10000UL)
+#endif
+
+#define BUF_SIZE            (1280U)
+#define OFFSET_MAX          (8U)
+
+static const uint16_t _sizes[] = { 20, 127, 1280 };
+static uint8_t _buf[BUF_SIZE + OFFSET_MAX];
+/* keeps the compiler from dropping the calculations */
+static volatile uint16_t _sum;
+
+static void _fill(uint8_t *buf, size_t len, unsigned pattern)
+{
+    switch (pattern) {
+        case 0:
+            memset(buf, 0x00, len);
+            break;
+        case 1:
+            memset(buf, 0xff, len);
+            break;
+        default:
+            random_bytes(buf, len);
+            break;
+    }
+}
+
+static unsigned _fuzz(void)
+{
+    unsigned errors = 0;
+
+    for (unsigned i = 0; i < FUZZ_RUNS; i++) {
+        unsigned offset = random_uint32_range(0, OFFSET_MAX);
+        uint16_t len = random_uint32_range(0, BUF_SIZE + 1);
+        uint16_t sum = random_uint32_range(0, UINT16_MAX + 1);
+        size_t accum_len = random_uint32_range(0, 4);
+        uint16_t expected, res;
+
+        _fill(&_buf[offset], len, i % 8);
+        expected = inet_csum_slice_bytewise(sum, &_buf[offset], len, accum_len);
+        res = inet_csum_slice(sum, &_buf[offset], len, accum_len);
+        if (res != expected) {
+            printf("len %u, offset %u, sum 0x%04x, accum_len %u: "
+                   "0x%04x != 0x%04x\n", len, offset, sum,
+                   (unsigned)accum_len, res, expected);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int main(void)
+{
+    unsigned errors = _fuzz();
+
+    random_bytes(_buf, sizeof(_buf));
+    for (unsigned step = 0; step < ARRAY_SIZE(_sizes); step++) {
+        uint16_t len = _sizes[step];
+
+        for (unsigned offset = 0; offset < 2; offset++) {
+            char name[24];
+
+            snprintf(name, sizeof(name), "bytewise %u%s", len,
+                     offset ? " odd" : "");
+            BENCHMARK_FUNC(name, BENCH_RUNS,
+                           _sum = inet_csum_slice_bytewise(0, &_buf[offset],
+                                                           len, 0));
+            snprintf(name, sizeof(name), "wordwise %u%s", len,
+                     offset ? " odd" : "");
+            BENCHMARK_FUNC(name, BENCH_RUNS,
+                           _sum = inet_csum_slice(0, &_buf[offset], len, 0));
+        }
+    }
+    if (errors > 0) {
+        printf("%u checksums differ from the reference\n", errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
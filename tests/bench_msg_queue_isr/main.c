@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure messages sent per second into a message queue, while
+ *              an ISR sends messages to the same queue
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include "thread.h"
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef ISR_PERIOD
+#define ISR_PERIOD          (1000U)
+#endif
+
+#ifndef ISR_BURST
+#define ISR_BURST           (4U)
+#endif
+
+#define QUEUE_SIZE          (16U)
+
+static volatile unsigned _flag = 0;
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _other;
+static xtimer_t _isr_timer;
+static uint32_t _isr_target;
+static uint32_t _isr_latency_max;
+static uint32_t _isr_msgs;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _isr_callback(void *arg)
+{
+    uint32_t now = xtimer_now_usec();
+    msg_t test;
+
+    (void)arg;
+    if ((now - _isr_target) > _isr_latency_max) {
+        _isr_latency_max = now - _isr_target;
+    }
+    for (unsigned i = 0; i < ISR_BURST; i++) {
+        _isr_msgs += msg_send_int(&test, _other);
+    }
+    if (!_flag) {
+        _isr_target = xtimer_now_usec() + ISR_PERIOD;
+        xtimer_set(&_isr_timer, ISR_PERIOD);
+    }
+}
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+    while (1) {
+        msg_receive(&test);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    printf("main starting\n");
+
+    _other = thread_create(_stack,
+                           sizeof(_stack),
+                           (THREAD_PRIORITY_MAIN - 1),
+                           THREAD_CREATE_STACKTEST,
+                           _second_thread,
+                           NULL,
+                           "second_thread");
+
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+    _isr_timer.callback = _isr_callback;
+
+    msg_t test;
+
+    uint32_t n = 0;
+
+    xtimer_set(&timer, TEST_DURATION);
+    _isr_target = xtimer_now_usec() + ISR_PERIOD;
+    xtimer_set(&_isr_timer, ISR_PERIOD);
+    while (!_flag) {
+        n += msg_try_send(&test, _other);
+    }
+    xtimer_remove(&_isr_timer);
+
+    printf("{ \"result\" : %" PRIu32 ", \"isr_msgs\" : %" PRIu32
+           ", \"irq_latency_max\" : %" PRIu32 " }\n",
+           n, _isr_msgs, _isr_latency_max);
+
+    return 0;
+}
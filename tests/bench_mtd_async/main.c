@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Blocking vs. queued writes of small records to flash
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "mtd_native.h"
+#include "mutex.h"
+#include "xtimer.h"
+
+#ifndef RECORD_SIZE
+#define RECORD_SIZE         (64U)
+#endif
+
+#ifndef SECTORS
+#define SECTORS             (4U)
+#endif
+
+#define SECTOR_SIZE         (MTD_SECTOR_SIZE)
+#define AREA_SIZE           (SECTORS * SECTOR_SIZE)
+#define RECORDS             (AREA_SIZE / RECORD_SIZE)
+
+static uint8_t _data[AREA_SIZE];
+static uint8_t _readback[AREA_SIZE];
+static mtd_req_t _reqs[RECORDS];
+static mtd_req_t _erase_req;
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _pending;
+static unsigned _errors;
+
+static void _fill(uint32_t seed)
+{
+    for (unsigned i = 0; i < AREA_SIZE; i += sizeof(seed)) {
+        uint32_t word = (seed + i) * 2654435761U;
+        memcpy(&_data[i], &word, sizeof(word));
+    }
+}
+
+static void _complete(mtd_req_t *req)
+{
+    if (req->res < 0) {
+        _errors++;
+    }
+    if (--_pending == 0) {
+        mutex_unlock(&_done);
+    }
+}
+
+static int _blocking(void)
+{
+    if (mtd_erase(MTD_0, 0, AREA_SIZE) < 0) {
+        return -1;
+    }
+    for (unsigned i = 0; i < RECORDS; i++) {
+        if (mtd_write(MTD_0, &_data[i * RECORD_SIZE], i * RECORD_SIZE,
+                      RECORD_SIZE) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _queued(void)
+{
+    _pending = RECORDS + 1;
+    _errors = 0;
+
+    _erase_req.op = MTD_REQ_ERASE;
+    _erase_req.addr = 0;
+    _erase_req.count = AREA_SIZE;
+    _erase_req.cb = _complete;
+    if (mtd_submit(MTD_0, &_erase_req) < 0) {
+        return -1;
+    }
+    for (unsigned i = 0; i < RECORDS; i++) {
+        _reqs[i].op = MTD_REQ_WRITE;
+        _reqs[i].buf = &_data[i * RECORD_SIZE];
+        _reqs[i].addr = i * RECORD_SIZE;
+        _reqs[i].count = RECORD_SIZE;
+        _reqs[i].cb = _complete;
+        if (mtd_submit(MTD_0, &_reqs[i]) < 0) {
+            return -1;
+        }
+    }
+    mutex_lock(&_done);
+
+    return (_errors > 0) ? -1 : 0;
+}
+
+static int _run(const char *name, int (*func)(void), uint32_t seed)
+{
+    mtd_native_dev_t *dev = (mtd_native_dev_t *)MTD_0;
+
+    _fill(seed);
+    mtd_native_reset_stats(dev);
+
+    uint32_t start = xtimer_now_usec();
+    if (func() < 0) {
+        printf("%s: writing failed\n", name);
+        return -1;
+    }
+    uint32_t wall = xtimer_now_usec() - start;
+
+    if ((mtd_read(MTD_0, _readback, 0, AREA_SIZE) < 0) ||
+        memcmp(_data, _readback, AREA_SIZE)) {
+        printf("%s: verification failed\n", name);
+        return -1;
+    }
+    printf("%s: %" PRIu32 " ms, %" PRIu32 " pages programmed\n",
+           name, wall / 1000, dev->stats.writes);
+    return 0;
+}
+
+int main(void)
+{
+    mtd_native_dev_t *dev = (mtd_native_dev_t *)MTD_0;
+
+    if (mtd_init(MTD_0) < 0) {
+        puts("Unable to initialize the flash emulation");
+        puts("[FAILED]");
+        return 1;
+    }
+    /* let the emulation block for the configured latencies */
+    dev->sleep = true;
+
+    printf("%u records of %u bytes\n", (unsigned)RECORDS, RECORD_SIZE);
+    if ((_run("blocking", _blocking, 1) < 0) ||
+        (_run("queued", _queued, 2) < 0)) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
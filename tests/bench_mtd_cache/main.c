@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       File system like workload with and without the MTD page cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_native.h"
+
+#define RECORD_SIZE         (64U)
+#define RECORDS             (1024U)
+#define SYNC_INTERVAL       (16U)
+
+#define SECTOR_SIZE         (MTD_SECTOR_SIZE)
+#define SUPERBLOCK_ADDR     (0U)
+#define TABLE_ADDR          (SECTOR_SIZE)
+#define DATA_ADDR           (2 * SECTOR_SIZE)
+#define AREA_SIZE           (DATA_ADDR + RECORDS * RECORD_SIZE)
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(NULL);
+
+static uint8_t _record[RECORD_SIZE];
+static uint8_t _buf[RECORD_SIZE];
+
+static void _fill(uint32_t num)
+{
+    for (unsigned i = 0; i < RECORD_SIZE; i += sizeof(num)) {
+        uint32_t word = num * 2654435761U + i;
+        memcpy(&_record[i], &word, sizeof(word));
+    }
+}
+
+static int _append(mtd_dev_t *dev, uint32_t num)
+{
+    uint32_t entry = TABLE_ADDR + num * sizeof(num);
+
+    /* look up the volume parameters and the free space */
+    if ((mtd_read(dev, _buf, SUPERBLOCK_ADDR, 32) < 0) ||
+        (mtd_read(dev, _buf, entry & ~15UL, 16) < 0)) {
+        return -1;
+    }
+    _fill(num);
+    if (mtd_write(dev, _record, DATA_ADDR + num * RECORD_SIZE,
+                  RECORD_SIZE) < 0) {
+        return -1;
+    }
+    /* mark the record as used in the allocation table */
+    if (mtd_write(dev, &num, entry, sizeof(num)) < 0) {
+        return -1;
+    }
+    if ((num % SYNC_INTERVAL == SYNC_INTERVAL - 1) && (mtd_flush(dev) < 0)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _verify(void)
+{
+    for (uint32_t num = 0; num < RECORDS; num++) {
+        uint32_t entry;
+
+        _fill(num);
+        if ((mtd_read(MTD_0, _buf, DATA_ADDR + num * RECORD_SIZE,
+                      RECORD_SIZE) < 0) ||
+            (mtd_read(MTD_0, &entry, TABLE_ADDR + num * sizeof(num),
+                      sizeof(entry)) < 0)) {
+            return -1;
+        }
+        if (memcmp(_record, _buf, RECORD_SIZE) || (entry != num)) {
+            printf("record %" PRIu32 " is corrupt\n", num);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _run(const char *name, mtd_dev_t *dev)
+{
+    mtd_native_dev_t *flash = (mtd_native_dev_t *)MTD_0;
+
+    if (mtd_erase(dev, 0, AREA_SIZE) < 0) {
+        return -1;
+    }
+    mtd_native_reset_stats(flash);
+
+    for (uint32_t num = 0; num < RECORDS; num++) {
+        if (_append(dev, num) < 0) {
+            printf("%s: record %" PRIu32 " failed\n", name, num);
+            return -1;
+        }
+    }
+    printf("%s: %" PRIu32 " reads, %" PRIu32 " pages programmed, "
+           "flash busy for %" PRIu32 " ms\n", name, flash->stats.reads,
+           flash->stats.writes, (uint32_t)(flash->stats.busy_us / 1000));
+
+    return _verify();
+}
+
+int main(void)
+{
+    _cache.parent = MTD_0;
+    if (mtd_init(&_cache.mtd) < 0) {
+        puts("Unable to initialize the flash emulation");
+        puts("[FAILED]");
+        return 1;
+    }
+
+    if ((_run("direct", MTD_0) < 0) || (_run("cached", &_cache.mtd) < 0)) {
+        puts("[FAILED]");
+        return 1;
+    }
+    printf("cache: %" PRIu32 " hits, %" PRIu32 " misses, "
+           "%" PRIu32 " pages written back\n", _cache.stats.hits,
+           _cache.stats.misses, _cache.stats.writebacks);
+    puts("[SUCCESS]");
+    return 0;
+}
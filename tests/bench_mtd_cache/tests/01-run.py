@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for mode in ("direct", "cached"):
+        child.expect(r"{}: \d+ reads, \d+ pages programmed, "
+                     r"flash busy for \d+ ms".format(mode))
+    child.expect(r"cache: \d+ hits, \d+ misses, \d+ pages written back")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Log-structured workload on the native flash emulation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "mtd_native.h"
+#include "xtimer.h"
+
+#ifndef RING_SECTORS
+#define RING_SECTORS        (64U)
+#endif
+
+#ifndef RECORDS
+#define RECORDS             (100000UL)
+#endif
+
+#define RECORD_SIZE         (MTD_PAGE_SIZE)
+#define SECTOR_SIZE         (MTD_SECTOR_SIZE)
+#define RECORDS_PER_SECTOR  (SECTOR_SIZE / RECORD_SIZE)
+
+static uint8_t _record[RECORD_SIZE];
+static uint8_t _readback[RECORD_SIZE];
+
+static void _fill(uint32_t num)
+{
+    for (unsigned i = 0; i < RECORD_SIZE; i += sizeof(num)) {
+        uint32_t word = num * 2654435761U + i;
+        memcpy(&_record[i], &word, sizeof(word));
+    }
+}
+
+static int _append(uint32_t num)
+{
+    uint32_t slot = num % (RING_SECTORS * RECORDS_PER_SECTOR);
+    uint32_t addr = slot * RECORD_SIZE;
+
+    if ((addr % SECTOR_SIZE == 0) && (mtd_erase(MTD_0, addr, SECTOR_SIZE) < 0)) {
+        return -1;
+    }
+    _fill(num);
+    if ((mtd_write(MTD_0, _record, addr, RECORD_SIZE) < 0) ||
+        (mtd_read(MTD_0, _readback, addr, RECORD_SIZE) < 0)) {
+        return -1;
+    }
+    return memcmp(_record, _readback, RECORD_SIZE) ? -1 : 0;
+}
+
+int main(void)
+{
+    mtd_native_dev_t *dev = (mtd_native_dev_t *)MTD_0;
+
+    if (mtd_init(MTD_0) < 0) {
+        puts("Unable to initialize the flash emulation");
+        puts("[FAILED]");
+        return 1;
+    }
+    mtd_native_reset_stats(dev);
+
+    uint32_t start = xtimer_now_usec();
+    for (uint32_t num = 0; num < RECORDS; num++) {
+        if (_append(num) < 0) {
+            printf("Record %" PRIu32 " failed\n", num);
+            puts("[FAILED]");
+            return 1;
+        }
+    }
+    uint32_t wall = xtimer_now_usec() - start;
+
+    uint32_t min_wear = UINT32_MAX;
+    for (unsigned sector = 0; sector < RING_SECTORS; sector++) {
+        uint32_t wear = mtd_native_get_wear(dev, sector);
+        if (wear < min_wear) {
+            min_wear = wear;
+        }
+    }
+
+    printf("wall time: %" PRIu32 " ms, emulated flash time: %" PRIu32 " ms\n",
+           wall / 1000, (uint32_t)(dev->stats.busy_us / 1000));
+    printf("reads: %" PRIu32 ", pages programmed: %" PRIu32
+           ", sectors erased: %" PRIu32 "\n",
+           dev->stats.reads, dev->stats.writes, dev->stats.erases);
+    printf("erase count of ring sectors: min %" PRIu32 ", max %" PRIu32 "\n",
+           min_wear, dev->stats.max_wear);
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"wall time: \d+ ms, emulated flash time: \d+ ms")
+    child.expect(r"reads: \d+, pages programmed: \d+, sectors erased: \d+")
+    child.expect(r"erase count of ring sectors: min \d+, max \d+")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Block-wise transfer time versus window size over a slow link
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef LINK_DELAY_US
+#define LINK_DELAY_US       (20U * US_PER_MS)
+#endif
+
+#ifndef LINK_JITTER_US
+#define LINK_JITTER_US      (LINK_DELAY_US / 4)
+#endif
+
+#define IMAGE_SIZE          (8192U)
+#define BLOCK_SIZE          (64U)
+#define BLOCKS_NUMOF        (IMAGE_SIZE / BLOCK_SIZE)
+#define PDU_SIZE            (128U)
+#define QUEUE_LEN           (16U)
+
+/* the first request for every LOSS_INTERVAL-th block is lost */
+#define LOSS_INTERVAL       (50U)
+#define LOSS_WINDOW         (4U)
+/* the server fails this block, its response overtakes the one before, see
+ * the jitter in _server() */
+#define FAIL_BLOCK          (40U)
+
+enum {
+    LINK_DELAY,             /**< responses are delayed */
+    LINK_LOSS,              /**< some requests are lost as well */
+    LINK_FAIL,              /**< the server fails a block */
+};
+
+/* a response held back by the emulated link */
+typedef struct {
+    uint32_t due;
+    size_t len;
+    sock_udp_ep_t remote;
+    uint8_t buf[PDU_SIZE];
+} _delayed_t;
+
+static const unsigned _windows[] = { 1, 2, 4, 8 };
+static volatile unsigned _link = LINK_DELAY;
+static uint8_t _lost[BLOCKS_NUMOF];
+static uint8_t _image[IMAGE_SIZE];
+static _delayed_t _queue[QUEUE_LEN];
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+
+static ssize_t _image_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                              void *context)
+{
+    (void)context;
+    coap_block_slicer_t slicer;
+    coap_block2_init(pkt, &slicer);
+    uint8_t *payload = buf + coap_get_total_hdr_len(pkt);
+    uint8_t *bufpos = payload;
+
+    bufpos += coap_opt_put_block2(bufpos, 0, &slicer, 1);
+    *bufpos++ = 0xff;
+    bufpos += coap_blockwise_put_bytes(&slicer, bufpos, _image, IMAGE_SIZE);
+
+    return coap_block2_build_reply(pkt, COAP_CODE_205, buf, len,
+                                   bufpos - payload, &slicer);
+}
+
+/* must be sorted by path (ASCII order) */
+const coap_resource_t coap_resources[] = {
+    { "/image", COAP_GET, _image_handler, NULL },
+};
+
+const unsigned coap_resources_numof = ARRAY_SIZE(coap_resources);
+
+static _delayed_t *_queue_next(void)
+{
+    _delayed_t *next = NULL;
+
+    for (unsigned i = 0; i < QUEUE_LEN; i++) {
+        if (_queue[i].len && (!next || ((int32_t)(_queue[i].due - next->due) < 0))) {
+            next = &_queue[i];
+        }
+    }
+    return next;
+}
+
+static _delayed_t *_queue_free(void)
+{
+    for (unsigned i = 0; i < QUEUE_LEN; i++) {
+        if (!_queue[i].len) {
+            return &_queue[i];
+        }
+    }
+    return NULL;
+}
+
+/* drop the first request for some blocks */
+static bool _lose(coap_pkt_t *pkt)
+{
+    unsigned num = coap_get_id(pkt);
+
+    if ((_link != LINK_LOSS) || (num >= BLOCKS_NUMOF) ||
+        ((num % LOSS_INTERVAL) != (LOSS_INTERVAL - 1)) || _lost[num]) {
+        return false;
+    }
+    _lost[num] = 1;
+    return true;
+}
+
+/* CoAP server whose responses are delayed as if sent over a slow link */
+static void *_server(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = COAP_PORT };
+    sock_udp_t sock;
+    uint8_t buf[PDU_SIZE];
+
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("server: unable to create sock");
+        return NULL;
+    }
+    while (1) {
+        _delayed_t *next = _queue_next();
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        sock_udp_ep_t remote;
+
+        if (next) {
+            int32_t left = (int32_t)(next->due - xtimer_now_usec());
+            timeout = (left > 0) ? (uint32_t)left : 0;
+        }
+
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+        coap_pkt_t pkt;
+        _delayed_t *slot;
+        if ((res > 0) && (coap_parse(&pkt, buf, res) >= 0) && !_lose(&pkt) &&
+            ((slot = _queue_free()) != NULL)) {
+            /* jitter the delay by message ID to reorder the responses */
+            uint32_t delay = LINK_DELAY_US +
+                             (coap_get_id(&pkt) % 4) * LINK_JITTER_US;
+
+            if ((_link == LINK_FAIL) && (coap_get_id(&pkt) == FAIL_BLOCK)) {
+                res = coap_build_reply(&pkt, COAP_CODE_INTERNAL_SERVER_ERROR,
+                                       slot->buf, sizeof(slot->buf), 0);
+            }
+            else {
+                res = coap_handle_req(&pkt, slot->buf, sizeof(slot->buf));
+            }
+            if (res > 0) {
+                slot->due = xtimer_now_usec() + delay;
+                slot->remote = remote;
+                slot->len = res;
+            }
+        }
+
+        /* release the responses that have crossed the link */
+        while ((next = _queue_next()) &&
+               ((int32_t)(next->due - xtimer_now_usec()) <= 0)) {
+            sock_udp_send(&sock, next->buf, next->len, &next->remote);
+            next->len = 0;
+        }
+    }
+
+    return NULL;
+}
+
+static int _check_block(void *arg, size_t offset, uint8_t *buf, size_t len,
+                        int more)
+{
+    size_t *received = arg;
+
+    if ((offset != *received) || (offset + len > IMAGE_SIZE) ||
+        memcmp(&_image[offset], buf, len)) {
+        printf("unexpected block at offset %u\n", (unsigned)offset);
+        return -1;
+    }
+    *received += len;
+    if (!more && (*received != IMAGE_SIZE)) {
+        printf("transfer ended after %u bytes\n", (unsigned)*received);
+        return -1;
+    }
+    return 0;
+}
+
+static int _fetch(sock_udp_ep_t *remote, unsigned window, size_t *received,
+                  uint32_t *msec)
+{
+    uint32_t start = xtimer_now_usec();
+    int res = nanocoap_get_blockwise(remote, "/image", COAP_BLOCKSIZE_64,
+                                     window, _check_block, received);
+
+    *msec = (xtimer_now_usec() - start) / US_PER_MS;
+    return res;
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = COAP_PORT };
+    unsigned errors = 0;
+    size_t received;
+    uint32_t msec;
+    int res;
+
+    for (unsigned i = 0; i < IMAGE_SIZE; i++) {
+        _image[i] = (i * 7) + (i >> 8);
+    }
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _server, NULL, "server");
+
+    printf("fetching %u bytes, link delay %" PRIu32 " us\n", IMAGE_SIZE,
+           (uint32_t)LINK_DELAY_US);
+    for (unsigned i = 0; i < ARRAY_SIZE(_windows); i++) {
+        received = 0;
+        res = _fetch(&remote, _windows[i], &received, &msec);
+        if ((res < 0) || (received != IMAGE_SIZE)) {
+            printf("window %u: failed (%d)\n", _windows[i], res);
+            errors++;
+            continue;
+        }
+        printf("window %u: %u bytes in %" PRIu32 " ms\n", _windows[i],
+               (unsigned)received, msec);
+    }
+
+    /* the lost requests have to be retransmitted */
+    _link = LINK_LOSS;
+    received = 0;
+    res = _fetch(&remote, LOSS_WINDOW, &received, &msec);
+    if ((res < 0) || (received != IMAGE_SIZE)) {
+        printf("loss: failed (%d)\n", res);
+        errors++;
+    }
+    else {
+        printf("loss: %u bytes in %" PRIu32 " ms\n", (unsigned)received,
+               msec);
+    }
+
+    /* the blocks before the failed one are handed over in order, the
+     * failure is only reported once they are */
+    _link = LINK_FAIL;
+    received = 0;
+    res = _fetch(&remote, LOSS_WINDOW, &received, &msec);
+    if ((res >= 0) || (received != FAIL_BLOCK * BLOCK_SIZE)) {
+        printf("fail: unexpected result %d after %u bytes\n", res,
+               (unsigned)received);
+        errors++;
+    }
+    else {
+        printf("fail: aborted after %u bytes\n", (unsigned)received);
+    }
+    if (errors > 0) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+WINDOWS = (1, 2, 4, 8)
+
+
+def testfunc(child):
+    for window in WINDOWS:
+        child.expect(r"window {}: \d+ bytes in \d+ ms".format(window),
+                     timeout=TIMEOUT)
+    child.expect(r"loss: \d+ bytes in \d+ ms", timeout=TIMEOUT)
+    child.expect(r"fail: aborted after \d+ bytes", timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
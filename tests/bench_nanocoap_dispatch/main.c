@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the CoAP resource look-up
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/nanocoap.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define RESOURCES_MAX       (128U)
+#define URIS_NUMOF          (64U)
+#define PATH_LEN            (16U)
+
+static const unsigned _resource_steps[] = { 8, 32, 128 };
+static char _paths[RESOURCES_MAX][PATH_LEN];
+static coap_resource_t _resources[RESOURCES_MAX];
+static uint8_t _uris[URIS_NUMOF][PATH_LEN + 8];
+static coap_method_flags_t _methods[URIS_NUMOF];
+static unsigned _resources_numof;
+static unsigned _errors;
+/* keeps the compiler from dropping the look-ups */
+static const coap_resource_t *volatile _found;
+
+/* look-up as done by coap_tree_handler() and gcoap before, for reference */
+static const coap_resource_t *_find_linear(uint8_t *uri,
+                                           coap_method_flags_t method_flag)
+{
+    for (unsigned i = 0; i < _resources_numof; i++) {
+        const coap_resource_t *resource = &_resources[i];
+
+        if (!(resource->methods & method_flag)) {
+            continue;
+        }
+
+        int res = coap_match_path(resource, uri);
+        if (res > 0) {
+            continue;
+        }
+        else if (res < 0) {
+            break;
+        }
+        else {
+            return resource;
+        }
+    }
+    return NULL;
+}
+
+static void _init(unsigned numof)
+{
+    /* /<group>/<i>, with every fourth resource matching its subtree; the
+     * zero padded numbers keep the paths sorted */
+    for (unsigned i = 0; i < numof; i++) {
+        snprintf(_paths[i], PATH_LEN, "/%c/%03u", 'a' + (i / 32), i);
+        _resources[i].path = _paths[i];
+        _resources[i].methods = COAP_GET | COAP_PUT;
+        if ((i % 4) == 3) {
+            _resources[i].methods |= COAP_MATCH_SUBTREE;
+        }
+    }
+    _resources_numof = numof;
+    /* spread the requests over all resources */
+    for (unsigned i = 0; i < URIS_NUMOF; i++) {
+        unsigned idx = (i * 37) % numof;
+
+        snprintf((char *)_uris[i], sizeof(_uris[i]), "%s%s", _paths[idx],
+                 (_resources[idx].methods & COAP_MATCH_SUBTREE) ? "/sub" : "");
+        _methods[i] = ((i % 8) == 7) ? COAP_POST : COAP_GET;
+    }
+}
+
+static void _check(unsigned i)
+{
+    if (_find_linear(_uris[i], _methods[i]) !=
+        coap_find_resource(_resources, _resources_numof, _uris[i],
+                           _methods[i], NULL)) {
+        _errors++;
+    }
+}
+
+int main(void)
+{
+    for (unsigned step = 0; step < ARRAY_SIZE(_resource_steps); step++) {
+        unsigned numof = _resource_steps[step];
+        char name[16];
+
+        _init(numof);
+        /* i is the iteration counter of BENCHMARK_FUNC */
+        snprintf(name, sizeof(name), "linear %u", numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS,
+                       _found = _find_linear(_uris[i % URIS_NUMOF],
+                                             _methods[i % URIS_NUMOF]));
+        snprintf(name, sizeof(name), "binary %u", numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS,
+                       _found = coap_find_resource(_resources, numof,
+                                                   _uris[i % URIS_NUMOF],
+                                                   _methods[i % URIS_NUMOF],
+                                                   NULL));
+        for (unsigned i = 0; i < URIS_NUMOF; i++) {
+            _check(i);
+        }
+    }
+    if (_errors > 0) {
+        printf("%u look-ups returned the wrong resource\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
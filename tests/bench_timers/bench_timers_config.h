@@ -241,6 +241,24 @@ extern "C" {
 /* estimate_cpu_overhead will loop for this many iterations to get a proper estimate */
 #define ESTIMATE_CPU_ITERATIONS 2048
 
+/* Measure the cost of ztimer_set() and ztimer_remove() before the benchmark */
+#ifndef TEST_ZTIMER_OPS
+#define TEST_ZTIMER_OPS 0
+#endif
+/* Largest number of active timers for the ztimer_set()/ztimer_remove() test */
+#ifndef ZTIMER_OPS_TIMERS_MAX
+#define ZTIMER_OPS_TIMERS_MAX 256
+#endif
+/* Number of ztimer_set()/ztimer_remove() pairs per number of active timers */
+#ifndef ZTIMER_OPS_ROUNDS
+#define ZTIMER_OPS_ROUNDS 1000
+#endif
+/* Timer targets of the ztimer_set()/ztimer_remove() test are drawn from
+ * [1, ZTIMER_OPS_SPAN) mock clock ticks */
+#ifndef ZTIMER_OPS_SPAN
+#define ZTIMER_OPS_SPAN (1ul << 20)
+#endif
+
 #if TEST_XTIMER
 #define READ_TUT() _xtimer_now()
 #else
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Cost of ztimer_set() and ztimer_remove() against the number of
+ *              active timers
+ *
+ * The timers are set on a mock clock, so the measurement is not disturbed by
+ * the hardware timer and the timers of the application.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "bench_timers_config.h"
+
+#if TEST_ZTIMER_OPS
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "matstat.h"
+#include "random.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "ztimer_ops.h"
+
+static ztimer_mock_t _mock;
+static ztimer_t _timers[ZTIMER_OPS_TIMERS_MAX];
+
+static uint32_t _random_target(void)
+{
+    return random_uint32_range(1, ZTIMER_OPS_SPAN);
+}
+
+static void _cb(void *arg)
+{
+    /* keep the number of active timers constant */
+    ztimer_set(&_mock.super, arg, _random_target());
+}
+
+static void _add_sample(matstat_state_t *state, uint32_t begin)
+{
+    uint32_t end = timer_read(TIM_REF_DEV);
+
+    /* Discard the sample if the reference timer overflowed */
+    if (end >= begin) {
+        matstat_add(state, end - begin);
+    }
+}
+
+static void _print_row(unsigned active, const matstat_state_t *set,
+                       const matstat_state_t *remove)
+{
+    char buf[20];
+
+    print(buf, fmt_lpad(buf, fmt_u32_dec(buf, active), 7, ' '));
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, matstat_mean(set)), 10, ' '));
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, set->max), 9, ' '));
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, matstat_mean(remove)), 13, ' '));
+    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, remove->max), 12, ' '));
+    print("\n", 1);
+}
+
+void ztimer_ops_benchmark(void)
+{
+    unsigned active = 0;
+
+    ztimer_mock_init(&_mock, 32);
+    print_str("ztimer_set()/ztimer_remove() duration in reference timer ticks ");
+    if (IS_USED(MODULE_ZTIMER_WHEEL)) {
+        print_str("(timing wheel)\n");
+    }
+    else {
+        print_str("(sorted list)\n");
+    }
+    print_str("max: worst case time with interrupts disabled\n");
+    print_str(" active  set mean  set max  remove mean  remove max\n");
+    for (unsigned numof = 1; numof <= ZTIMER_OPS_TIMERS_MAX; numof *= 4) {
+        matstat_state_t set = MATSTAT_STATE_INIT;
+        matstat_state_t remove = MATSTAT_STATE_INIT;
+
+        for (; active < numof; active++) {
+            _timers[active].callback = _cb;
+            _timers[active].arg = &_timers[active];
+            ztimer_set(&_mock.super, &_timers[active], _random_target());
+        }
+        for (unsigned k = 0; k < ZTIMER_OPS_ROUNDS; k++) {
+            ztimer_t *timer = &_timers[random_uint32_range(0, active)];
+            uint32_t begin;
+
+            /* let time pass, so expiring timers and the clock's book keeping
+             * are part of the measurement */
+            ztimer_mock_advance(&_mock, random_uint32_range(0, 16));
+            begin = timer_read(TIM_REF_DEV);
+            ztimer_remove(&_mock.super, timer);
+            _add_sample(&remove, begin);
+            begin = timer_read(TIM_REF_DEV);
+            ztimer_set(&_mock.super, timer, _random_target());
+            _add_sample(&set, begin);
+        }
+        _print_row(active, &set, &remove);
+    }
+    for (unsigned k = 0; k < active; k++) {
+        ztimer_remove(&_mock.super, &_timers[k]);
+    }
+}
+#else /* TEST_ZTIMER_OPS */
+typedef int dont_be_pedantic;
+#endif /* TEST_ZTIMER_OPS */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Cost of ztimer_set() and ztimer_remove() against the number of
+ *              active timers
+ */
+
+#ifndef ZTIMER_OPS_H
+#define ZTIMER_OPS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @brief   Measure and print the duration of ztimer_set() and
+ *          ztimer_remove() on a mock clock for a growing number of active
+ *          timers
+ *
+ * Both functions run with interrupts disabled for their whole duration, so
+ * the maximum is the worst case interrupt latency they introduce.
+ *
+ * @pre The reference timer TIM_REF_DEV must be initialized and running.
+ */
+void ztimer_ops_benchmark(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_OPS_H */
+/** @} */
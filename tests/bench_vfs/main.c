@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for path and file descriptor resolution in VFS
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "benchmark.h"
+#include "fs/constfs.h"
+#include "kernel_defines.h"
+#include "vfs.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define MOUNTS_MAX          (64U)
+/* file descriptors left free while measuring */
+#define FDS_FREE            (2U)
+
+#define FILE_PATH           "/mnt/00/file.txt"
+
+static const uint8_t _data[] = "benchmark";
+
+static const constfs_file_t _files[] = {
+    {
+        .path = "/file.txt",
+        .data = _data,
+        .size = sizeof(_data),
+    },
+};
+
+static const constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+static const unsigned _mount_steps[] = { 1, 8, 64 };
+static vfs_mount_t _mounts[MOUNTS_MAX];
+static char _mount_points[MOUNTS_MAX][sizeof("/mnt/00")];
+static unsigned _mounts_numof = 0;
+static unsigned _errors = 0;
+
+static int _add_mounts(unsigned num)
+{
+    for (; _mounts_numof < num; _mounts_numof++) {
+        vfs_mount_t *mount = &_mounts[_mounts_numof];
+
+        snprintf(_mount_points[_mounts_numof], sizeof(_mount_points[0]),
+                 "/mnt/%02u", _mounts_numof);
+        mount->mount_point = _mount_points[_mounts_numof];
+        mount->fs = &constfs_file_system;
+        mount->private_data = (void *)&_fs;
+        if (vfs_mount(mount) < 0) {
+            printf("Unable to mount %s\n", mount->mount_point);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _open_close(void)
+{
+    int fd = vfs_open(FILE_PATH, O_RDONLY, 0);
+
+    if ((fd < 0) || (vfs_close(fd) < 0)) {
+        _errors++;
+    }
+}
+
+static void _stat(void)
+{
+    struct stat buf;
+
+    if (vfs_stat(FILE_PATH, &buf) < 0) {
+        _errors++;
+    }
+}
+
+int main(void)
+{
+    if (_add_mounts(1) < 0) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    /* occupy the lower file descriptors, free ones are at the end */
+    while (1) {
+        int fd = vfs_open(FILE_PATH, O_RDONLY, 0);
+        if (fd < 0) {
+            puts("Unable to open file");
+            puts("[FAILED]");
+            return 1;
+        }
+        if (fd >= VFS_MAX_OPEN_FILES - (int)FDS_FREE) {
+            vfs_close(fd);
+            break;
+        }
+    }
+
+    for (unsigned step = 0; step < ARRAY_SIZE(_mount_steps); step++) {
+        char name[32];
+
+        if (_add_mounts(_mount_steps[step]) < 0) {
+            puts("[FAILED]");
+            return 1;
+        }
+        snprintf(name, sizeof(name), "open/close, %u mounts", _mounts_numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _open_close());
+        snprintf(name, sizeof(name), "stat, %u mounts", _mounts_numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _stat());
+    }
+
+    if (_errors > 0) {
+        printf("%u operations failed\n", _errors);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the filter look-up of the CAN router against a reference
+ *              matcher
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "embUnit.h"
+#include "can/common.h"
+#include "can/dll.h"
+#include "can/pkt.h"
+#include "can/raw.h"
+#include "can/router.h"
+#include "kernel_defines.h"
+#include "msg.h"
+#include "thread.h"
+
+#define IFNUM               (0)
+/* every registered filter may match a frame, each match is one message */
+#define FILTERS_NUMOF       (16U)
+#define MSG_QUEUE_SIZE      (16U)
+#define RANDOM_STEPS        (2000U)
+#define RANDOM_FRAMES       (4U)
+#define RANDOM_SEED         (0x2f6b1d3aU)
+
+/* identifiers of frames and filters differ only in these bits, so that
+ * filters of different masks match the same frames */
+#define ID_BASE             (0x120U)
+#define ID_BITS             (0x1803U)
+
+/**
+ * @brief   Reference of a registered filter, also passed as parameter of
+ *          the filter
+ */
+typedef struct {
+    canid_t can_id;
+    canid_t mask;
+    bool used;
+} filter_t;
+
+/* more masks for single identifiers than the router has hash slots */
+static const canid_t _masks[] = {
+    CAN_SFF_MASK,
+    CAN_EFF_MASK,
+    CAN_SFF_MASK | 0x800U,
+    CAN_SFF_MASK | 0x1000U,
+    0x7f0U,
+    0x7fcU,
+    0U,
+};
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static can_reg_entry_t _entry;
+static filter_t _filters[FILTERS_NUMOF];
+static uint32_t _rand_state;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, the sequence must be the same on every platform */
+    _rand_state ^= _rand_state << 13;
+    _rand_state ^= _rand_state >> 17;
+    _rand_state ^= _rand_state << 5;
+    return _rand_state;
+}
+
+static canid_t _rand_id(void)
+{
+    return ID_BASE | (_rand() & ID_BITS);
+}
+
+/* returns if a filter other than @p skip is registered for @p can_id and
+ * @p mask */
+static bool _in_use(canid_t can_id, canid_t mask, const filter_t *skip)
+{
+    for (unsigned i = 0; i < FILTERS_NUMOF; i++) {
+        if (_filters[i].used && (&_filters[i] != skip) &&
+            (_filters[i].can_id == can_id) && (_filters[i].mask == mask)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _register(unsigned slot, canid_t can_id, canid_t mask)
+{
+    filter_t *filter = &_filters[slot];
+
+    TEST_ASSERT(!filter->used);
+    TEST_ASSERT_EQUAL_INT(_in_use(can_id, mask, NULL),
+                          can_router_register(&_entry, can_id, mask, filter));
+    filter->can_id = can_id;
+    filter->mask = mask;
+    filter->used = true;
+}
+
+static void _unregister(unsigned slot)
+{
+    filter_t *filter = &_filters[slot];
+
+    TEST_ASSERT(filter->used);
+    filter->used = false;
+    TEST_ASSERT_EQUAL_INT(_in_use(filter->can_id, filter->mask, NULL),
+                          can_router_unregister(&_entry, filter->can_id,
+                                                filter->mask, filter));
+}
+
+/* dispatches a frame with @p can_id and expects it to be received once for
+ * every matching filter */
+static void _dispatch(canid_t can_id)
+{
+    struct can_frame frame = { .can_id = can_id, .can_dlc = 0 };
+    uint32_t expected = 0, received = 0;
+    can_pkt_t *pkt;
+    msg_t msg;
+
+    for (unsigned i = 0; i < FILTERS_NUMOF; i++) {
+        if (_filters[i].used &&
+            ((can_id & _filters[i].mask) == _filters[i].can_id)) {
+            expected |= (1UL << i);
+        }
+    }
+    pkt = can_pkt_alloc_rx(IFNUM, &frame);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, can_router_dispatch_rx_indic(pkt));
+    while (msg_try_receive(&msg) > 0) {
+        can_rx_data_t *rx = msg.content.ptr;
+        unsigned slot = (filter_t *)rx->arg - _filters;
+
+        TEST_ASSERT_EQUAL_INT(CAN_MSG_RX_INDICATION, msg.type);
+        TEST_ASSERT(slot < FILTERS_NUMOF);
+        TEST_ASSERT(!(received & (1UL << slot)));
+        received |= (1UL << slot);
+        TEST_ASSERT_EQUAL_INT(0, raw_can_free_frame(rx));
+    }
+    TEST_ASSERT_EQUAL_INT(expected, received);
+}
+
+static void set_up(void)
+{
+    _rand_state = RANDOM_SEED;
+}
+
+static void tear_down(void)
+{
+    msg_t msg;
+
+    /* clean up after a failed test */
+    while (msg_try_receive(&msg) > 0) {
+        raw_can_free_frame(msg.content.ptr);
+    }
+    for (unsigned i = 0; i < FILTERS_NUMOF; i++) {
+        if (_filters[i].used) {
+            can_router_unregister(&_entry, _filters[i].can_id,
+                                  _filters[i].mask, &_filters[i]);
+            _filters[i].used = false;
+        }
+    }
+}
+
+static void test_router__exact(void)
+{
+    _register(0, 0x123, CAN_SFF_MASK);
+    _dispatch(0x123);
+    _dispatch(0x124);
+    /* a second filter for the same identifier */
+    _register(1, 0x123, CAN_SFF_MASK);
+    _dispatch(0x123);
+    _unregister(0);
+    _dispatch(0x123);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, can_router_unregister(&_entry, 0x123,
+                                                         CAN_SFF_MASK,
+                                                         &_filters[0]));
+    _unregister(1);
+    _dispatch(0x123);
+}
+
+static void test_router__mask_classes(void)
+{
+    /* one filter per mask, the masks registered last are only listed */
+    for (unsigned i = 0; i < ARRAY_SIZE(_masks); i++) {
+        _register(i, ID_BASE & _masks[i], _masks[i]);
+    }
+    _dispatch(ID_BASE);
+    _dispatch(ID_BASE | 0x800);
+    _dispatch(ID_BASE | 0x1000);
+    /* every freed slot goes to the next listed mask for single identifiers */
+    for (unsigned i = 0; i < ARRAY_SIZE(_masks); i++) {
+        _unregister(i);
+        _dispatch(ID_BASE);
+        _dispatch(ID_BASE | 0x800);
+        _dispatch(ID_BASE | 0x1000);
+    }
+}
+
+static void test_router__random(void)
+{
+    for (unsigned step = 0; step < RANDOM_STEPS; step++) {
+        unsigned slot = _rand() % FILTERS_NUMOF;
+
+        if (_filters[slot].used) {
+            _unregister(slot);
+        }
+        else {
+            canid_t mask = _masks[_rand() % ARRAY_SIZE(_masks)];
+
+            _register(slot, _rand_id() & mask, mask);
+        }
+        for (unsigned i = 0; i < RANDOM_FRAMES; i++) {
+            _dispatch(_rand_id());
+        }
+    }
+}
+
+static Test *tests_can_router(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_router__exact),
+        new_TestFixture(test_router__mask_classes),
+        new_TestFixture(test_router__random),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    can_dll_init();
+    _entry.ifnum = IFNUM;
+    _entry.target.pid = thread_getpid();
+#ifdef MODULE_CAN_MBOX
+    _entry.type = CAN_TYPE_DEFAULT;
+#endif
+
+    TESTS_START();
+    TESTS_RUN(tests_can_router());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the handling of transport layer checksums between
+ *              gnrc_netif and gnrc_ipv6
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/ext/frag.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/interactive_sync.h"
+#include "utlist.h"
+
+#define MSG_QUEUE_SIZE  (8U)
+#define PORT            (61616U)
+#define PAYLOAD_LEN     (16U)
+#define STALE_CSUM      (0x1234U)
+
+static const uint8_t _dev_addr[] = { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x6f };
+static const uint8_t _peer_addr[] = { 0x41, 0x9b, 0x9f, 0x56, 0x36, 0x46 };
+/* neither address is assigned to the interface, so gnrc_ipv6 drops received
+ * packets and sends from the given source */
+static const ipv6_addr_t _src = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    } };
+static const ipv6_addr_t _dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+
+/* frame handed to the interface on receive */
+static uint8_t _rx_frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) +
+                         PAYLOAD_LEN];
+/* UDP payload of sent packets */
+static uint8_t _payload[ETHERNET_DATA_LEN];
+/* IPv6 packet of the last UDP frame, or of the first fragment of a UDP
+ * packet, sent by the interface */
+static uint8_t _tx_pkt[ETHERNET_DATA_LEN];
+static size_t _tx_pkt_len;
+/* interface header flags of the last packet passed up by the interface */
+static uint8_t _rx_flags;
+
+static int _dev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[ETHERNET_FRAME_LEN];
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(hdr + 1);
+    ipv6_ext_frag_t *frag = (ipv6_ext_frag_t *)(ipv6 + 1);
+    size_t len = 0;
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        if ((len + iolist->iol_len) > sizeof(frame)) {
+            return -EOVERFLOW;
+        }
+        memcpy(&frame[len], iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    /* ignore neighbor discovery */
+    if ((byteorder_ntohs(hdr->type) == ETHERTYPE_IPV6) &&
+        ((ipv6->nh == PROTNUM_UDP) ||
+         ((ipv6->nh == PROTNUM_IPV6_EXT_FRAG) && (frag->nh == PROTNUM_UDP) &&
+          (ipv6_ext_frag_get_offset(frag) == 0)))) {
+        _tx_pkt_len = len - sizeof(ethernet_hdr_t);
+        memcpy(_tx_pkt, ipv6, _tx_pkt_len);
+    }
+    return len;
+}
+
+static int _dev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_rx_frame);
+    }
+    if (len < (int)sizeof(_rx_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _rx_frame, sizeof(_rx_frame));
+    return sizeof(_rx_frame);
+}
+
+static void _dev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _dev_get_addr(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(_dev_addr)) {
+        return -ENOBUFS;
+    }
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+static int _dev_get_rx_csum_offload(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(netopt_enable_t)) {
+        return -ENOBUFS;
+    }
+    *((netopt_enable_t *)value) = NETOPT_ENABLE;
+    return sizeof(netopt_enable_t);
+}
+
+/* passes an IPv6 packet with next header @p nh up the stack and stores the
+ * flags of its interface header in @ref _rx_flags */
+static void _receive(uint8_t nh)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_rx_frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(hdr + 1);
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                        thread_getpid());
+    gnrc_pktsnip_t *netif;
+    msg_t msg;
+
+    memset(_rx_frame, 0, sizeof(_rx_frame));
+    memcpy(hdr->dst, _dev_addr, sizeof(_dev_addr));
+    memcpy(hdr->src, _peer_addr, sizeof(_peer_addr));
+    hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(PAYLOAD_LEN);
+    ipv6->nh = nh;
+    ipv6->hl = 64;
+    ipv6->src = _src;
+    ipv6->dst = _dst;
+
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me);
+    netdev_trigger_event_isr((netdev_t *)&_dev);
+    do {
+        msg_receive(&msg);
+    } while (msg.type != GNRC_NETAPI_MSG_TYPE_RCV);
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &me);
+
+    netif = gnrc_pktsnip_search_type(msg.content.ptr, GNRC_NETTYPE_NETIF);
+    TEST_ASSERT_NOT_NULL(netif);
+    _rx_flags = ((gnrc_netif_hdr_t *)netif->data)->flags;
+    gnrc_pktbuf_release(msg.content.ptr);
+}
+
+/* sends a UDP packet with @p payload_len bytes of @ref _payload and the
+ * checksum @p csum over the interface, the sent packet ends up in
+ * @ref _tx_pkt */
+static void _send(uint16_t csum, uint8_t netif_hdr_flags, size_t payload_len)
+{
+    static const ipv6_addr_t all_nodes = IPV6_ADDR_ALL_NODES_LINK_LOCAL;
+    gnrc_pktsnip_t *pkt, *netif;
+    udp_hdr_t *udp;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, payload_len, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    TEST_ASSERT_NOT_NULL(pkt);
+    udp = pkt->data;
+    udp->length = byteorder_htons(gnrc_pkt_len(pkt));
+    udp->checksum = byteorder_htons(csum);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_src, &all_nodes);
+    TEST_ASSERT_NOT_NULL(pkt);
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    TEST_ASSERT_NOT_NULL(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    ((gnrc_netif_hdr_t *)netif->data)->flags = netif_hdr_flags;
+    LL_PREPEND(pkt, netif);
+
+    _tx_pkt_len = 0;
+    /* IPv6 and the interface have a higher priority, the frame is sent when
+     * this returns */
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_send(gnrc_ipv6_pid, pkt));
+    TEST_ASSERT(_tx_pkt_len > 0);
+}
+
+static udp_hdr_t *_tx_udp(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_tx_pkt;
+
+    if (ipv6->nh == PROTNUM_IPV6_EXT_FRAG) {
+        return (udp_hdr_t *)&_tx_pkt[sizeof(ipv6_hdr_t) +
+                                     sizeof(ipv6_ext_frag_t)];
+    }
+    return (udp_hdr_t *)&_tx_pkt[sizeof(ipv6_hdr_t)];
+}
+
+static uint16_t _tx_csum(void)
+{
+    return byteorder_ntohs(_tx_udp()->checksum);
+}
+
+/* checks the checksum of the whole UDP packet, also if only its first
+ * fragment was captured */
+static bool _tx_csum_valid(void)
+{
+    udp_hdr_t *udp = _tx_udp();
+    uint16_t len = byteorder_ntohs(udp->length);
+    uint16_t csum = ipv6_hdr_inet_csum(0, (ipv6_hdr_t *)_tx_pkt, PROTNUM_UDP,
+                                       len);
+
+    csum = inet_csum(csum, (uint8_t *)udp, sizeof(udp_hdr_t));
+    csum = inet_csum(csum, _payload, len - sizeof(udp_hdr_t));
+    return (csum == 0xffff);
+}
+
+static void test_rx__udp(void)
+{
+    _receive(PROTNUM_UDP);
+    TEST_ASSERT(_rx_flags & GNRC_NETIF_HDR_FLAGS_CSUM_VALID);
+}
+
+static void test_rx__tcp(void)
+{
+    _receive(PROTNUM_TCP);
+    TEST_ASSERT(_rx_flags & GNRC_NETIF_HDR_FLAGS_CSUM_VALID);
+}
+
+static void test_rx__fragment(void)
+{
+    /* the checksum covers the reassembled packet, the device can't check it */
+    _receive(PROTNUM_IPV6_EXT_FRAG);
+    TEST_ASSERT(!(_rx_flags & GNRC_NETIF_HDR_FLAGS_CSUM_VALID));
+}
+
+static void test_rx__ext_hdr(void)
+{
+    _receive(PROTNUM_IPV6_EXT_HOPOPT);
+    TEST_ASSERT(!(_rx_flags & GNRC_NETIF_HDR_FLAGS_CSUM_VALID));
+}
+
+static void test_tx__stale_csum(void)
+{
+    /* a checksum the sender did not mark is calculated again */
+    _send(STALE_CSUM, 0, PAYLOAD_LEN);
+    TEST_ASSERT(_tx_csum() != STALE_CSUM);
+    TEST_ASSERT(_tx_csum_valid());
+}
+
+static void test_tx__preset_csum(void)
+{
+    _send(STALE_CSUM, GNRC_NETIF_HDR_FLAGS_CSUM_PRESET, PAYLOAD_LEN);
+    TEST_ASSERT_EQUAL_INT(STALE_CSUM, _tx_csum());
+}
+
+static void test_tx__offload(void)
+{
+    /* the checksum is left to the device */
+    _netif.flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    _send(STALE_CSUM, 0, PAYLOAD_LEN);
+    _netif.flags &= ~GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    TEST_ASSERT_EQUAL_INT(PROTNUM_UDP, ((ipv6_hdr_t *)_tx_pkt)->nh);
+    TEST_ASSERT_EQUAL_INT(STALE_CSUM, _tx_csum());
+}
+
+static void test_tx__offload_fragmented(void)
+{
+    /* the UDP packet fits into the MTU, but not with the IPv6 header */
+    size_t len = _netif.ipv6.mtu - sizeof(ipv6_hdr_t) - sizeof(udp_hdr_t) + 1;
+
+    _netif.flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    _send(STALE_CSUM, 0, len);
+    _netif.flags &= ~GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    /* the device can't insert a checksum over several fragments */
+    TEST_ASSERT_EQUAL_INT(PROTNUM_IPV6_EXT_FRAG, ((ipv6_hdr_t *)_tx_pkt)->nh);
+    TEST_ASSERT_EQUAL_INT(len + sizeof(udp_hdr_t),
+                          byteorder_ntohs(_tx_udp()->length));
+    TEST_ASSERT(_tx_csum_valid());
+}
+
+static Test *tests_gnrc_csum_offload(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rx__udp),
+        new_TestFixture(test_rx__tcp),
+        new_TestFixture(test_rx__fragment),
+        new_TestFixture(test_rx__ext_hdr),
+        new_TestFixture(test_tx__stale_csum),
+        new_TestFixture(test_tx__preset_csum),
+        new_TestFixture(test_tx__offload),
+        new_TestFixture(test_tx__offload_fragmented),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    for (unsigned i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i;
+    }
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _dev_send);
+    netdev_test_set_recv_cb(&_dev, _dev_recv);
+    netdev_test_set_isr_cb(&_dev, _dev_isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _dev_get_addr);
+    netdev_test_set_get_cb(&_dev, NETOPT_RX_CSUM_OFFLOAD,
+                           _dev_get_rx_csum_offload);
+    gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                               GNRC_NETIF_PRIO, "netdev_test",
+                               (netdev_t *)&_dev);
+
+    test_utils_interactive_sync();
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_csum_offload());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB unittests with the hash index for on-link entries
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "test_utils/interactive_sync.h"
+
+extern void tests_gnrc_ipv6_nib(void);
+
+int main(void)
+{
+    test_utils_interactive_sync();
+
+    TESTS_START();
+    tests_gnrc_ipv6_nib();
+    TESTS_END();
+
+    return 0;
+}
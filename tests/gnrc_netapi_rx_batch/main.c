@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests dispatching batches of received packets to registry
+ *              entries with and without gnrc_netreg_entry_t::rcv_batch
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "thread.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+
+#define PKTS            (3U)
+
+/* the messages dispatched to the entries end up in the message queue of the
+ * test thread */
+#define MSG_QUEUE_SIZE  (8U)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _entries[2];
+static gnrc_pktsnip_t *_pkts[PKTS];
+static gnrc_pktsnip_t *_batch;
+
+static void set_up(void)
+{
+    gnrc_netreg_init();
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < PKTS; i++) {
+        _pkts[i] = gnrc_pktbuf_add(NULL, &i, sizeof(i), GNRC_NETTYPE_TEST);
+    }
+    _batch = gnrc_pktbuf_add(NULL, _pkts, sizeof(_pkts), GNRC_NETTYPE_UNDEF);
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], GNRC_NETREG_DEMUX_CTX_ALL,
+                                   thread_getpid());
+    }
+}
+
+static void tear_down(void)
+{
+    msg_t msg;
+
+    while (msg_try_receive(&msg) > 0) {}
+}
+
+static void _register(bool rcv_batch)
+{
+    unsigned i = gnrc_netreg_num(GNRC_NETTYPE_TEST, GNRC_NETREG_DEMUX_CTX_ALL);
+
+    _entries[i].rcv_batch = rcv_batch;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_entries[i]));
+}
+
+static void _dispatch(int numof)
+{
+    TEST_ASSERT_NOT_NULL(_batch);
+    TEST_ASSERT_EQUAL_INT(numof,
+                          gnrc_netapi_dispatch_receive_batch(GNRC_NETTYPE_TEST,
+                                                             GNRC_NETREG_DEMUX_CTX_ALL,
+                                                             _batch));
+}
+
+/* expects the next message to be the batch */
+static void _expect_batch(void)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV_BATCH, msg.type);
+    TEST_ASSERT(_batch == msg.content.ptr);
+    TEST_ASSERT_EQUAL_INT(PKTS, gnrc_netapi_batch_numof(_batch));
+    for (unsigned i = 0; i < PKTS; i++) {
+        TEST_ASSERT(_pkts[i] == gnrc_netapi_batch_get(_batch, i));
+    }
+}
+
+/* expects the next messages to be the packets of the batch, in order */
+static void _expect_pkts(void)
+{
+    msg_t msg;
+
+    for (unsigned i = 0; i < PKTS; i++) {
+        TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+        TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+        TEST_ASSERT(_pkts[i] == msg.content.ptr);
+    }
+}
+
+static void _release(unsigned users)
+{
+    for (unsigned i = 0; i < PKTS; i++) {
+        TEST_ASSERT_EQUAL_INT(users, _pkts[i]->users);
+        gnrc_pktbuf_release(_pkts[i]);
+    }
+}
+
+static void test_netapi_dispatch_receive_batch__no_subscriber(void)
+{
+    _dispatch(0);
+    /* the caller keeps all references */
+    TEST_ASSERT_EQUAL_INT(1, _batch->users);
+    gnrc_pktbuf_release(_batch);
+    _release(1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_receive_batch__opted_in(void)
+{
+    _register(true);
+    _dispatch(1);
+    _expect_batch();
+    TEST_ASSERT_EQUAL_INT(1, _batch->users);
+    gnrc_pktbuf_release(_batch);
+    _release(1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_receive_batch__not_opted_in(void)
+{
+    _register(false);
+    _dispatch(1);
+    /* the batch is released right away, every packet comes on its own */
+    _expect_pkts();
+    _release(1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_receive_batch__mixed(void)
+{
+    _register(true);
+    _register(false);
+    _dispatch(2);
+    /* the entry registered last is served first */
+    _expect_pkts();
+    _expect_batch();
+    TEST_ASSERT_EQUAL_INT(1, _batch->users);
+    gnrc_pktbuf_release(_batch);
+    _release(2);
+    _release(1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_netapi_rx_batch(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netapi_dispatch_receive_batch__no_subscriber),
+        new_TestFixture(test_netapi_dispatch_receive_batch__opted_in),
+        new_TestFixture(test_netapi_dispatch_receive_batch__not_opted_in),
+        new_TestFixture(test_netapi_dispatch_receive_batch__mixed),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netapi_rx_batch());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the prioritized transmission of gnrc_netif
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/interactive_sync.h"
+#include "xtimer.h"
+
+#define DSCP_BE         (0U)
+#define DSCP_EF         (46U)
+
+/* the first packet blocks the interface, the others fill its message queue */
+#define BURST_SIZE      (GNRC_NETIF_MSG_QUEUE_SIZE + 1)
+
+static const uint8_t _dst[] = { 0xf5, 0x19, 0x9a, 0x1d, 0xd8, 0x8f };
+static const uint8_t _dev_addr[] = { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x6f };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+
+static mutex_t _blocker = MUTEX_INIT;
+static bool _block;
+static uint8_t _sent[BURST_SIZE];
+static uint32_t _sent_at[BURST_SIZE];
+static unsigned _sent_numof;
+
+static int _dev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    const iolist_t *last = iolist;
+    int res = 0;
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        res += iolist->iol_len;
+        last = iolist;
+    }
+    /* the payload is the number of the packet */
+    if (_sent_numof < BURST_SIZE) {
+        _sent[_sent_numof] = ((uint8_t *)last->iol_base)[last->iol_len - 1];
+        _sent_at[_sent_numof] = xtimer_now_usec();
+    }
+    _sent_numof++;
+    if (_block) {
+        /* wait until the test queued up its send requests */
+        _block = false;
+        mutex_lock(&_blocker);
+        mutex_unlock(&_blocker);
+    }
+    return res;
+}
+
+static int _dev_get_addr(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(_dev_addr)) {
+        return -ENOBUFS;
+    }
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+static void _send(uint8_t num, uint8_t dscp)
+{
+    gnrc_pktsnip_t *pkt, *ipv6, *netif;
+    ipv6_hdr_t *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, &num, sizeof(num), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    ipv6 = gnrc_pktbuf_add(pkt, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    ipv6_hdr_set_tc_dscp(hdr, dscp);
+    hdr->len = byteorder_htons(sizeof(num));
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    netif = gnrc_netif_hdr_build(NULL, 0, _dst, sizeof(_dst));
+    TEST_ASSERT_NOT_NULL(netif);
+    netif->next = ipv6;
+    TEST_ASSERT(gnrc_netif_send(&_netif, netif) > 0);
+}
+
+/* sends packet 0 and keeps the device busy with it while @p fill queues up
+ * the other packets */
+static void _burst(void (*fill)(void))
+{
+    _sent_numof = 0;
+    _block = true;
+    mutex_lock(&_blocker);
+    _send(0, DSCP_BE);
+    /* the interface thread has a higher priority, so it already hangs in the
+     * send callback */
+    TEST_ASSERT_EQUAL_INT(1, _sent_numof);
+    fill();
+    mutex_unlock(&_blocker);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    /* the interface thread pauses after every packet */
+    xtimer_usleep((BURST_SIZE + 1) * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    for (unsigned i = 1; i < _sent_numof; i++) {
+        TEST_ASSERT((_sent_at[i] - _sent_at[i - 1]) >=
+                    CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    }
+#endif
+    /* the interface thread sent everything before the test continues */
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void _fill_be(void)
+{
+    for (unsigned i = 1; i < BURST_SIZE; i++) {
+        _send(i, DSCP_BE);
+    }
+}
+
+static void _fill_ef_last(void)
+{
+    for (unsigned i = 1; i < CONFIG_GNRC_NETIF_TX_QUEUE_SIZE; i++) {
+        _send(i, DSCP_BE);
+    }
+    _send(CONFIG_GNRC_NETIF_TX_QUEUE_SIZE, DSCP_EF);
+}
+
+static void test_tx_sched__burst(void)
+{
+    _burst(_fill_be);
+    /* more requests than fit into the send queue, none is lost and the order
+     * of a single class is kept */
+    TEST_ASSERT_EQUAL_INT(BURST_SIZE, _sent_numof);
+    for (unsigned i = 0; i < BURST_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(i, _sent[i]);
+    }
+}
+
+static void test_tx_sched__priority(void)
+{
+    _burst(_fill_ef_last);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_TX_QUEUE_SIZE + 1, _sent_numof);
+    /* expedited forwarding overtakes the best effort packets queued before */
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_TX_QUEUE_SIZE, _sent[1]);
+    for (unsigned i = 2; i <= CONFIG_GNRC_NETIF_TX_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(i - 1, _sent[i]);
+    }
+}
+
+static Test *tests_gnrc_netif_tx_sched(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tx_sched__burst),
+        new_TestFixture(test_tx_sched__priority),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _dev_send);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _dev_get_addr);
+    gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                               GNRC_NETIF_PRIO, "netdev_test",
+                               (netdev_t *)&_dev);
+
+    test_utils_interactive_sync();
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_tx_sched());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1 @@
+../gnrc_netif_tx_sched/main.c
\ No newline at end of file
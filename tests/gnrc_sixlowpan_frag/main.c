@@ -315,6 +315,34 @@ static void test_rbuf_add__success_duplicate_fragments(void)
     _check_pktbuf(entry);
 }
 
+static void test_rbuf_add__success_adjacent_fragments(void)
+{
+    gnrc_pktsnip_t *pkt3 = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt4 = gnrc_pktbuf_add(NULL, _fragment4, sizeof(_fragment4),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    const gnrc_sixlowpan_frag_rb_t *entry;
+
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt3, TEST_FRAGMENT3_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt2, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt4);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt4, TEST_FRAGMENT4_OFFSET, TEST_PAGE
+        )));
+    /* intervals of adjacent fragments are merged into one */
+    _test_entry(entry, TEST_DATAGRAM_SIZE - TEST_FRAGMENT2_OFFSET,
+                TEST_FRAGMENT2_OFFSET, TEST_DATAGRAM_SIZE - 1);
+    _check_pktbuf(entry);
+}
+
 static void test_rbuf_add__success_complete(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
@@ -626,6 +654,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_first_fragment),
         new_TestFixture(test_rbuf_add__success_subsequent_fragment),
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
+        new_TestFixture(test_rbuf_add__success_adjacent_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
         new_TestFixture(test_rbuf_add__full_rbuf),
         new_TestFixture(test_rbuf_add__too_big_fragment),
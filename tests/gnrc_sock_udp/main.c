@@ -447,6 +447,65 @@ static void test_sock_udp_recv_buf__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_buf__chained(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    void *data = NULL, *ctx = NULL;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet_split(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), 2,
+                                _TEST_NETIF));
+    /* the snips are handed out in the order of the data */
+    expect(2 == sock_udp_recv_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT, NULL));
+    expect(memcmp("AB", data, 2) == 0);
+    expect(sizeof("CD") == sock_udp_recv_buf(&_sock, &data, &ctx,
+                                             SOCK_NO_TIMEOUT, NULL));
+    expect(memcmp("CD", data, sizeof("CD")) == 0);
+    expect(0 == sock_udp_recv_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT, NULL));
+    expect(data == NULL);
+    expect(ctx == NULL);
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv__chained(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet_split(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), 2,
+                                _TEST_NETIF));
+    expect(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer),
+                                           SOCK_NO_TIMEOUT, NULL));
+    expect(memcmp("ABCD", _test_buffer, sizeof("ABCD")) == 0);
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv__chained_ENOBUFS(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet_split(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), 2,
+                                _TEST_NETIF));
+    /* each snip fits, but not both of them */
+    expect(-ENOBUFS == sock_udp_recv(&_sock, _test_buffer, 3,
+                                     SOCK_NO_TIMEOUT, NULL));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -608,6 +667,48 @@ static void test_sock_udp_send__socketed_other_remote(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send__socketed_csum(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    /* both addresses are fixed, so sock calculates the checksum itself, also
+     * for a payload of odd length */
+    expect(3 == sock_udp_send(&_sock, "ABC", 3, NULL));
+    expect(_check_csum(&src_addr, &dst_addr, true));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send__socketed_other_remote_csum(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t sock_remote = { .addr = { .ipv6 = _TEST_ADDR_WRONG },
+                                               .family = AF_INET6,
+                                               .port = _TEST_PORT_REMOTE };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+
+    expect(0 == sock_udp_create(&_sock, &local, &sock_remote, SOCK_FLAGS_REUSE_EP));
+    /* the cached sum does not cover this remote, leave it to the stack */
+    expect(3 == sock_udp_send(&_sock, "ABC", 3, &remote));
+    expect(_check_csum(&src_addr, &dst_addr, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__unsocketed_no_local_no_netif(void)
 {
     static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
@@ -719,6 +820,25 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_sendv__no_sock(void)
+{
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .netif = _TEST_NETIF,
+                                          .port = _TEST_PORT_REMOTE };
+    iolist_t tail = { .iol_base = "CD", .iol_len = sizeof("CD") };
+    iolist_t empty = { .iol_next = &tail };
+    iolist_t head = { .iol_next = &empty, .iol_base = "AB", .iol_len = 2 };
+
+    expect(sizeof("ABCD") == sock_udp_sendv(NULL, &head, &remote));
+    expect(_check_packet(&ipv6_addr_unspecified, &dst_addr, 0,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, true));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -751,6 +871,9 @@ int main(void)
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_buf__chained());
+    CALL(test_sock_udp_recv__chained());
+    CALL(test_sock_udp_recv__chained_ENOBUFS());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -762,12 +885,15 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
+    CALL(test_sock_udp_send__socketed_csum());
+    CALL(test_sock_udp_send__socketed_other_remote_csum());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_local());
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_sendv__no_sock());
 
     puts("ALL TESTS SUCCESSFUL");
 
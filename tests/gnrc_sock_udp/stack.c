@@ -17,6 +17,7 @@
 
 
 #include "msg.h"
+#include "net/inet_csum.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netreg.h"
@@ -110,6 +111,27 @@ bool _inject_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
 }
 
+bool _inject_packet_split(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                          uint16_t src_port, uint16_t dst_port,
+                          void *data, size_t data_len, size_t split,
+                          uint16_t netif)
+{
+    gnrc_pktsnip_t *pkt = _build_udp_packet(src, dst, src_port, dst_port,
+                                            data, data_len, netif);
+
+    if (pkt == NULL) {
+        return false;
+    }
+    /* mark the headers like the stack does on reception, this leaves the
+     * later part of the payload in front */
+    if ((gnrc_pktbuf_mark(pkt, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP) == NULL) ||
+        (gnrc_pktbuf_mark(pkt, split, GNRC_NETTYPE_UNDEF) == NULL)) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    return (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, dst_port, pkt) > 0);
+}
+
 bool _check_net(void)
 {
     return (gnrc_pktbuf_is_sane() && gnrc_pktbuf_is_empty());
@@ -148,6 +170,13 @@ bool _check_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
         }
         ipv6 = pkt->next;
     }
+    else if (pkt->type == GNRC_NETTYPE_NETIF) {
+        /* a netif header without interface may only carry flags */
+        if (((gnrc_netif_hdr_t *)pkt->data)->if_pid != KERNEL_PID_UNDEF) {
+            return _res(pkt, false);
+        }
+        ipv6 = pkt->next;
+    }
     else {
         ipv6 = pkt;
     }
@@ -169,3 +198,44 @@ bool _check_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                 (data_len == udp->next->size) &&
                 (memcmp(data, udp->next->data, data_len) == 0));
 }
+
+bool _check_csum(const ipv6_addr_t *src, const ipv6_addr_t *dst, bool preset)
+{
+    gnrc_pktsnip_t *pkt, *ipv6, *udp;
+    ipv6_hdr_t *ipv6_hdr;
+    uint16_t csum;
+    size_t len = 0;
+    bool flag = false;
+    msg_t msg;
+
+    msg_receive(&msg);
+    if (msg.type != GNRC_NETAPI_MSG_TYPE_SND) {
+        return false;
+    }
+    pkt = msg.content.ptr;
+    if (pkt->type == GNRC_NETTYPE_NETIF) {
+        gnrc_netif_hdr_t *netif_hdr = pkt->data;
+
+        flag = (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_CSUM_PRESET);
+    }
+    ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    if ((ipv6 == NULL) || (udp == NULL) || (flag != preset)) {
+        return _res(pkt, false);
+    }
+    ipv6_hdr = ipv6->data;
+    if ((memcmp(src, &ipv6_hdr->src, sizeof(ipv6_addr_t)) != 0) ||
+        (memcmp(dst, &ipv6_hdr->dst, sizeof(ipv6_addr_t)) != 0)) {
+        return _res(pkt, false);
+    }
+    if (!preset) {
+        /* the network layer calculates it */
+        return _res(pkt, ((udp_hdr_t *)udp->data)->checksum.u16 == 0);
+    }
+    csum = ipv6_hdr_inet_csum(0, ipv6_hdr, PROTNUM_UDP, gnrc_pkt_len(udp));
+    for (gnrc_pktsnip_t *snip = udp; snip != NULL; snip = snip->next) {
+        csum = inet_csum_slice(csum, snip->data, snip->size, len);
+        len += snip->size;
+    }
+    return _res(pkt, csum == 0xffff);
+}
@@ -57,6 +57,27 @@ bool _inject_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                     uint16_t src_port, uint16_t dst_port,
                     void *data, size_t data_len, uint16_t netif);
 
+/**
+ * @brief   Injects a received UDP packet with its payload split over two
+ *          packet snips into the stack
+ *
+ * @param[in] src       The source address of the UDP packet
+ * @param[in] dst       The destination address of the UDP packet
+ * @param[in] src_port  The source port of the UDP packet
+ * @param[in] dst_port  The destination port of the UDP packet
+ * @param[in] data      The payload of the UDP packet
+ * @param[in] data_len  The payload length of the UDP packet
+ * @param[in] split     Length of the first payload snip
+ * @param[in] netif     The interface the packet came over
+ *
+ * @return  true, if packet was successfully injected
+ * @return  false, if an error occurred during injection
+ */
+bool _inject_packet_split(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                          uint16_t src_port, uint16_t dst_port,
+                          void *data, size_t data_len, size_t split,
+                          uint16_t netif);
+
 /**
  * @brief   Checks networking state (e.g. packet buffer state)
  *
@@ -86,6 +107,22 @@ bool _check_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                    void *data, size_t data_len, uint16_t netif,
                    bool random_src_port);
 
+/**
+ * @brief   Checks the UDP checksum of a packet sent by the networking
+ *          component
+ *
+ * @param[in] src               Expected source address of the UDP packet
+ * @param[in] dst               Expected destination address of the UDP packet
+ * @param[in] preset            Expect a checksum calculated by sock, marked
+ *                              with @ref GNRC_NETIF_HDR_FLAGS_CSUM_PRESET.
+ *                              Otherwise the checksum must be left to the
+ *                              network layer.
+ *
+ * @return  true, if the checksum is as expected
+ * @return  false, if not.
+ */
+bool _check_csum(const ipv6_addr_t *src, const ipv6_addr_t *dst, bool preset);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1 @@
+../msg_avail/main.c
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Checks that messages sent concurrently from an ISR and from
+ *              threads into the same message queue are received in order,
+ *              without loss or duplication
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef MSGS_PER_SENDER
+#define MSGS_PER_SENDER     (10000U)
+#endif
+
+#ifndef ISR_PERIOD
+#define ISR_PERIOD          (100U)
+#endif
+
+#ifndef ISR_BURST
+#define ISR_BURST           (4U)
+#endif
+
+/* the receiver gives up, if no message arrives for this long */
+#define RECEIVE_TIMEOUT     (1000000U)
+
+/* small, so that the queue runs full */
+#define QUEUE_SIZE          (4U)
+
+/**
+ * @brief   Senders, used as message type
+ */
+enum {
+    SENDER_ISR,
+    SENDER_TRY_SEND,
+    SENDER_SEND,
+    SENDER_NUMOF,
+};
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _receiver;
+static xtimer_t _isr_timer;
+static uint32_t _isr_seq;
+static uint32_t _isr_full;
+
+static void _isr_callback(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; (i < ISR_BURST) && (_isr_seq < MSGS_PER_SENDER);
+         i++) {
+        msg_t m = { .type = SENDER_ISR, .content.value = _isr_seq };
+
+        if (msg_send_int(&m, _receiver) != 1) {
+            /* queue is full, retry the same message with the next burst */
+            _isr_full++;
+            break;
+        }
+        _isr_seq++;
+    }
+    if (_isr_seq < MSGS_PER_SENDER) {
+        xtimer_set(&_isr_timer, ISR_PERIOD);
+    }
+}
+
+static void *_try_send_thread(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t seq = 0; seq < MSGS_PER_SENDER; seq++) {
+        msg_t m = { .type = SENDER_TRY_SEND, .content.value = seq };
+
+        while (msg_try_send(&m, _receiver) != 1) {
+            thread_yield();
+        }
+        if ((seq % 8) == 0) {
+            thread_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *_send_thread(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t seq = 0; seq < MSGS_PER_SENDER; seq++) {
+        msg_t m = { .type = SENDER_SEND, .content.value = seq };
+
+        msg_send(&m, _receiver);
+        if ((seq % 8) == 0) {
+            thread_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t expected[SENDER_NUMOF] = { 0 };
+    unsigned done = 0;
+    int res = 0;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+    _receiver = thread_getpid();
+    _isr_timer.callback = _isr_callback;
+
+    /* same priority as the receiver, so all threads take turns */
+    thread_create(_stacks[0], sizeof(_stacks[0]), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_STACKTEST, _try_send_thread, NULL, "try_send");
+    thread_create(_stacks[1], sizeof(_stacks[1]), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_STACKTEST, _send_thread, NULL, "send");
+    xtimer_set(&_isr_timer, ISR_PERIOD);
+
+    while (done < SENDER_NUMOF) {
+        msg_t m;
+
+        if (xtimer_msg_receive_timeout(&m, RECEIVE_TIMEOUT) < 0) {
+            puts("timeout, messages were lost");
+            res = 1;
+            break;
+        }
+        if (m.type >= SENDER_NUMOF) {
+            printf("unexpected message type %u\n", (unsigned)m.type);
+            res = 1;
+            break;
+        }
+        if (m.content.value != expected[m.type]) {
+            printf("sender %u: expected message %" PRIu32 ", got %" PRIu32
+                   "\n", (unsigned)m.type, expected[m.type], m.content.value);
+            res = 1;
+            break;
+        }
+        if (++expected[m.type] == MSGS_PER_SENDER) {
+            done++;
+        }
+        if ((expected[m.type] % 16) == 0) {
+            thread_yield();
+        }
+    }
+    xtimer_remove(&_isr_timer);
+    if (res == 0) {
+        msg_t m;
+
+        /* all senders are done, anything left is a duplicate */
+        xtimer_usleep(4 * ISR_PERIOD);
+        if (msg_try_receive(&m) == 1) {
+            printf("sender %u: unexpected message %" PRIu32 "\n",
+                   (unsigned)m.type, m.content.value);
+            res = 1;
+        }
+    }
+
+    for (unsigned i = 0; i < SENDER_NUMOF; i++) {
+        printf("sender %u: %" PRIu32 " messages received\n", i, expected[i]);
+    }
+    printf("ISR found the queue full %" PRIu32 " times\n", _isr_full);
+    puts(res ? "[FAILED]" : "[SUCCESS]");
+
+    return res;
+}
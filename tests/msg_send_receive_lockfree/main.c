@@ -0,0 +1 @@
+../msg_send_receive/main.c
\ No newline at end of file
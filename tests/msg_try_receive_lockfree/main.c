@@ -0,0 +1 @@
+../msg_try_receive/main.c
\ No newline at end of file
@@ -103,6 +103,7 @@ int nanotest_client_cmd(int argc, char **argv)
     }
 
     pkt.hdr = (coap_hdr_t *)buf;
+    pkt.snips = NULL;
 
     /* parse options */
     if (argc == 5 || argc == 6) {
@@ -6,15 +6,23 @@
  * directory for more details.
  */
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "net/nanocoap.h"
 #include "riotboot/flashwrite.h"
+#include "xtimer.h"
 
 static riotboot_flashwrite_t _writer;
 
+/* update timing: start of the update, time spent writing and the longest
+ * time a single block kept the transport waiting */
+static uint32_t _start;
+static uint32_t _write_usec;
+static uint32_t _write_max_usec;
+
 ssize_t _flashwrite_handler(coap_pkt_t* pkt, uint8_t *buf, size_t len, void *context)
 {
     riotboot_flashwrite_t *writer = context;
@@ -33,6 +41,9 @@ ssize_t _flashwrite_handler(coap_pkt_t* pkt, uint8_t *buf, size_t len, void *con
     if (block1.offset == 0) {
         printf("_flashwrite_handler(): init len=%u\n", pkt->payload_len);
         riotboot_flashwrite_init(writer, riotboot_slot_other());
+        _start = xtimer_now_usec();
+        _write_usec = 0;
+        _write_max_usec = 0;
     }
 
     /* skip first RIOTBOOT_FLASHWRITE_SKIPLEN bytes, but handle the case where
@@ -50,7 +61,13 @@ ssize_t _flashwrite_handler(coap_pkt_t* pkt, uint8_t *buf, size_t len, void *con
     }
 
     if (offset == writer->offset) {
+        uint32_t now = xtimer_now_usec();
         riotboot_flashwrite_putbytes(writer, payload_start, payload_len, block1.more);
+        now = xtimer_now_usec() - now;
+        _write_usec += now;
+        if (now > _write_max_usec) {
+            _write_max_usec = now;
+        }
     }
     else {
         printf("_flashwrite_handler(): skipping invalid offset (data=%u, writer=%u)\n", (unsigned)offset, (unsigned)writer->offset);
@@ -63,6 +80,10 @@ ssize_t _flashwrite_handler(coap_pkt_t* pkt, uint8_t *buf, size_t len, void *con
     if (!blockwise || !block1.more) {
         puts("_flashwrite_handler(): finish");
         riotboot_flashwrite_finish(writer);
+        printf("_flashwrite_handler(): %u bytes in %" PRIu32 " ms, "
+               "writing took %" PRIu32 " ms (max %" PRIu32 " us per block)\n",
+               (unsigned)writer->offset, (xtimer_now_usec() - _start) / 1000,
+               _write_usec / 1000, _write_max_usec);
     }
 
     ssize_t reply_len = coap_build_reply(pkt, result, buf, len, 0);
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Writes images in chunks of unaligned sizes into the other slot
+ *              and checks the slot contents and both digest verifications
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "periph/flashpage.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+
+/* largest chunk passed to riotboot_flashwrite_putbytes() at once */
+#define CHUNK_MAX           (251U)
+
+/* pages covered by a test image */
+#define IMG_PAGES           (3U)
+
+#define IMG_SEED            (0x6d2b79f5UL)
+
+/* the data starts after the magic number, so chunks of any of these sizes
+ * start and end unaligned and cross page boundaries at various positions */
+static const size_t _chunks_small[] = { 1, 3, 7, 13 };
+static const size_t _chunks_coap[] = { 64 };
+static const size_t _chunks_mixed[] = { 1, CHUNK_MAX - 1, 17, CHUNK_MAX, 129 };
+
+static riotboot_flashwrite_t _state;
+static uint8_t _chunk[CHUNK_MAX];
+static int _slot;
+
+static inline size_t min(size_t a, size_t b)
+{
+    return a <= b ? a : b;
+}
+
+/* content of the test image at @p pos, starting with the magic number */
+static uint8_t _img_byte(size_t pos)
+{
+    if (pos < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        return "RIOT"[pos];
+    }
+    return ((pos * 0x9e3779b1UL) ^ IMG_SEED) >> 13;
+}
+
+static void _img_fill(uint8_t *buf, size_t pos, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = _img_byte(pos + i);
+    }
+}
+
+static void _img_digest(size_t len, uint8_t *digest)
+{
+    sha256_context_t sha256;
+
+    sha256_init(&sha256);
+    for (size_t pos = 0; pos < len; pos += CHUNK_MAX) {
+        size_t n = min(CHUNK_MAX, len - pos);
+
+        _img_fill(_chunk, pos, n);
+        sha256_update(&sha256, _chunk, n);
+    }
+    sha256_final(&sha256, digest);
+}
+
+/* length of an image covering @p pages pages, minus @p short_by bytes */
+static size_t _img_len(unsigned pages, size_t short_by)
+{
+    size_t len = pages * FLASHPAGE_SIZE;
+
+    if (len > riotboot_flashwrite_slotsize(&_state)) {
+        len = riotboot_flashwrite_slotsize(&_state);
+    }
+    return len - short_by;
+}
+
+/* feeds the image up to @p len, cycling through the chunk sizes */
+static void _put(size_t len, size_t img_len, const size_t *chunks,
+                 unsigned chunks_numof)
+{
+    size_t pos = _state.offset;
+
+    for (unsigned i = 0; pos < len; i = (i + 1) % chunks_numof) {
+        size_t n = min(chunks[i], len - pos);
+
+        _img_fill(_chunk, pos, n);
+        TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_putbytes(&_state, _chunk,
+                                                              n, pos + n < img_len));
+        pos += n;
+    }
+    TEST_ASSERT_EQUAL_INT(len, _state.offset);
+}
+
+static void _check_slot(size_t len)
+{
+    const uint8_t *slot = (const uint8_t *)riotboot_slot_get_hdr(_slot);
+
+    for (size_t pos = 0; pos < len; pos++) {
+        TEST_ASSERT_EQUAL_INT(_img_byte(pos), slot[pos]);
+    }
+}
+
+/* writes the image in chunks and checks the result */
+static void _write(size_t len, const size_t *chunks, unsigned chunks_numof)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    _img_digest(len, digest);
+    _put(len, len, chunks, chunks_numof);
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_verify_sha256_stream(digest,
+                                                                      len,
+                                                                      &_state));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_finish(&_state));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_verify_sha256(digest, len,
+                                                               _slot));
+    _check_slot(len);
+
+    /* both verifications reject a wrong digest */
+    digest[SHA256_DIGEST_LENGTH - 1] ^= 1;
+    TEST_ASSERT_EQUAL_INT(1, riotboot_flashwrite_verify_sha256_stream(digest,
+                                                                      len,
+                                                                      &_state));
+    TEST_ASSERT_EQUAL_INT(1, riotboot_flashwrite_verify_sha256(digest, len,
+                                                               _slot));
+}
+
+static void set_up(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_init(&_state, _slot));
+}
+
+static void tear_down(void)
+{
+    /* never leave an image with a valid magic number behind */
+    flashpage_write(flashpage_page((void *)riotboot_slot_get_hdr(_slot)), NULL);
+    /* the running image must not be touched */
+    TEST_ASSERT_EQUAL_INT(0, riotboot_slot_validate(riotboot_slot_current()));
+}
+
+static void test_flashwrite__small_chunks(void)
+{
+    _write(_img_len(IMG_PAGES, 3), _chunks_small, ARRAY_SIZE(_chunks_small));
+}
+
+static void test_flashwrite__coap_blocks(void)
+{
+    _write(_img_len(IMG_PAGES, 3), _chunks_coap, ARRAY_SIZE(_chunks_coap));
+}
+
+static void test_flashwrite__mixed_chunks(void)
+{
+    _write(_img_len(IMG_PAGES, 3), _chunks_mixed, ARRAY_SIZE(_chunks_mixed));
+}
+
+static void test_flashwrite__page_aligned_end(void)
+{
+    /* the last chunk completes a page */
+    _write(_img_len(IMG_PAGES - 1, 0), _chunks_mixed,
+           ARRAY_SIZE(_chunks_mixed));
+}
+
+static void test_flashwrite__single_page(void)
+{
+    /* the whole image stays in the first page, written on finish */
+    _write(_img_len(1, 5), _chunks_small, ARRAY_SIZE(_chunks_small));
+}
+
+static void test_flashwrite__verify_stream_incomplete(void)
+{
+    size_t len = _img_len(IMG_PAGES, 3);
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    _img_digest(len, digest);
+    _put(len - 1, len, _chunks_mixed, ARRAY_SIZE(_chunks_mixed));
+    TEST_ASSERT_EQUAL_INT(-1, riotboot_flashwrite_verify_sha256_stream(digest,
+                                                                       len,
+                                                                       &_state));
+}
+
+static Test *tests_riotboot_flashwrite(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_flashwrite__small_chunks),
+        new_TestFixture(test_flashwrite__coap_blocks),
+        new_TestFixture(test_flashwrite__mixed_chunks),
+        new_TestFixture(test_flashwrite__page_aligned_end),
+        new_TestFixture(test_flashwrite__single_page),
+        new_TestFixture(test_flashwrite__verify_stream_incomplete),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    _slot = riotboot_slot_other();
+
+    TESTS_START();
+    TESTS_RUN(tests_riotboot_flashwrite());
+    TESTS_END();
+
+    return 0;
+}
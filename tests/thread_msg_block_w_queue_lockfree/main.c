@@ -0,0 +1 @@
+../thread_msg_block_w_queue/main.c
\ No newline at end of file
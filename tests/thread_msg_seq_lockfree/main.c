@@ -0,0 +1 @@
+../thread_msg_seq/main.c
\ No newline at end of file
@@ -11,13 +11,23 @@
  *
  * @file
  */
+#include <assert.h>
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
 #include "net/gcoap.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/udp.h"
 
 #include "unittests-constants.h"
 #include "tests-gcoap.h"
@@ -51,6 +61,53 @@ static gcoap_listener_t listener_second = {
 
 static const char *resource_list_str = "</act/switch>,</sensor/temp>,</test/info/all>,</second/part>";
 
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            void *ctx);
+static ssize_t _obs_link_encoder(const coap_resource_t *resource, char *buf,
+                                 size_t maxlen, coap_link_encoder_ctx_t *context);
+
+/*
+ * Observable resources for the memo tests, registered after the resource
+ * list test. The link encoder hides them from the resource list.
+ */
+static const coap_resource_t resources_obs[] = {
+    { .path = "/obs/a", .methods = (COAP_GET), .handler = _obs_handler },
+    { .path = "/obs/b", .methods = (COAP_GET), .handler = _obs_handler },
+    { .path = "/obs/c", .methods = (COAP_GET), .handler = _obs_handler },
+};
+
+static gcoap_listener_t listener_obs = {
+    .resources     = &resources_obs[0],
+    .resources_len = ARRAY_SIZE(resources_obs),
+    .link_encoder  = _obs_link_encoder,
+    .next          = NULL
+};
+
+/* gcoap sends to the test thread, which is registered for all UDP packets */
+#define MSG_QUEUE_SIZE  (8U)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _udp_reg;
+
+/* remote endpoint of the requests and Observe registrations */
+static const sock_udp_ep_t _remote = {
+    .family = AF_INET6,
+    .addr = { .ipv6 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+                        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+    .netif = SOCK_ADDR_ANY_NETIF,
+    .port = 5684,
+};
+static const ipv6_addr_t _local_addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    } };
+
+/* last call of _resp_handler() */
+static unsigned _resp_count;
+static unsigned _resp_state;
+static uintptr_t _resp_context;
+static bool _resp_remote;
+
 /*
  * Client GET request success case. Test request generation.
  * Request /time resource from libcoap example
@@ -385,6 +442,308 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, (char *)res);
 }
 
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            void *ctx)
+{
+    (void)ctx;
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static ssize_t _obs_link_encoder(const coap_resource_t *resource, char *buf,
+                                 size_t maxlen, coap_link_encoder_ctx_t *context)
+{
+    (void)resource;
+    (void)buf;
+    (void)maxlen;
+    (void)context;
+
+    return 0;
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+
+    _resp_count++;
+    _resp_state = memo->state;
+    _resp_context = (uintptr_t)memo->context;
+    _resp_remote = (remote != NULL);
+}
+
+/*
+ * Releases the packets gcoap sent to the test thread; returns their number.
+ */
+static unsigned _drain(void)
+{
+    msg_t msg;
+    unsigned sent = 0;
+
+    while (msg_try_receive(&msg) > 0) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+            gnrc_pktbuf_release(msg.content.ptr);
+            sent++;
+        }
+        else if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return sent;
+}
+
+/*
+ * Passes a CoAP message from @p remote to the gcoap sock. The gcoap thread
+ * has a higher priority, so the message is handled when this returns.
+ */
+static void _inject(const sock_udp_ep_t *remote, const uint8_t *data,
+                    size_t len)
+{
+    gnrc_pktsnip_t *pkt, *udp, *ipv6;
+    udp_hdr_t *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, data, len, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    udp = gnrc_pktbuf_add(NULL, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    TEST_ASSERT_NOT_NULL(udp);
+    hdr = udp->data;
+    hdr->src_port = byteorder_htons(remote->port);
+    hdr->dst_port = byteorder_htons(CONFIG_GCOAP_PORT);
+    hdr->length = byteorder_htons(sizeof(udp_hdr_t) + len);
+    hdr->checksum = byteorder_htons(0);
+    ipv6 = gnrc_ipv6_hdr_build(NULL, (ipv6_addr_t *)&remote->addr.ipv6,
+                               &_local_addr);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    /* received packets are ordered from the payload to the outer header */
+    pkt->next = udp;
+    udp->next = ipv6;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP,
+                                                          CONFIG_GCOAP_PORT,
+                                                          pkt));
+}
+
+/*
+ * Sends a GET request with all token bytes set to @p token, @p context is
+ * passed to _resp_handler().
+ */
+static size_t _req_send(uint8_t token, uintptr_t context)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    size_t res;
+
+    gcoap_req_init(&pdu, &buf[0], sizeof(buf), COAP_METHOD_GET, "/time");
+    memset(pdu.token, token, CONFIG_GCOAP_TOKENLEN);
+    res = gcoap_req_send(&buf[0], coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE),
+                         &_remote, _resp_handler, (void *)context);
+    _drain();
+    return res;
+}
+
+/*
+ * Injects a response with all token bytes set to @p token from @p remote.
+ */
+static void _resp_inject(const sock_udp_ep_t *remote, uint8_t token)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t tkn[CONFIG_GCOAP_TOKENLEN];
+
+    memset(tkn, token, sizeof(tkn));
+    ssize_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON, tkn,
+                                 sizeof(tkn), COAP_CODE_CONTENT, 1);
+    _inject(remote, &buf[0], len);
+}
+
+/*
+ * Injects a GET request for @p path with Observe value @p obs and all token
+ * bytes set to @p token; expects gcoap to respond.
+ */
+static void _obs_req(const char *path, uint8_t token, uint32_t obs)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    gcoap_req_init(&pdu, &buf[0], sizeof(buf), COAP_METHOD_GET, NULL);
+    memset(pdu.token, token, CONFIG_GCOAP_TOKENLEN);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, obs);
+    coap_opt_add_uri_path(&pdu, path);
+    _inject(&_remote, &buf[0], coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE));
+    TEST_ASSERT_EQUAL_INT(1, _drain());
+}
+
+/*
+ * Expects a notification for @p resource to carry a token with all bytes
+ * set to @p token.
+ */
+static void _expect_obs(const coap_resource_t *resource, uint8_t token)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    TEST_ASSERT_EQUAL_INT(GCOAP_OBS_INIT_OK,
+                          gcoap_obs_init(&pdu, &buf[0], sizeof(buf), resource));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GCOAP_TOKENLEN, coap_get_token_len(&pdu));
+    for (unsigned i = 0; i < CONFIG_GCOAP_TOKENLEN; i++) {
+        TEST_ASSERT_EQUAL_INT(token, pdu.token[i]);
+    }
+}
+
+static void _expect_no_obs(const coap_resource_t *resource)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    TEST_ASSERT_EQUAL_INT(GCOAP_OBS_INIT_UNUSED,
+                          gcoap_obs_init(&pdu, &buf[0], sizeof(buf), resource));
+}
+
+static void set_up(void)
+{
+    _resp_count = 0;
+    _resp_state = GCOAP_MEMO_UNUSED;
+    _resp_context = 0;
+    _resp_remote = false;
+}
+
+static void tear_down(void)
+{
+    _drain();
+}
+
+/*
+ * A response matches a request only by token and remote endpoint.
+ */
+static void test_gcoap__memo_req_match(void)
+{
+    sock_udp_ep_t other = _remote;
+
+    TEST_ASSERT(_req_send(0x11, 1) > 0);
+    TEST_ASSERT_EQUAL_INT(1, gcoap_op_state());
+
+    _resp_inject(&_remote, 0x12);
+    other.port++;
+    _resp_inject(&other, 0x11);
+    TEST_ASSERT_EQUAL_INT(0, _resp_count);
+    TEST_ASSERT_EQUAL_INT(1, gcoap_op_state());
+
+    _resp_inject(&_remote, 0x11);
+    TEST_ASSERT_EQUAL_INT(1, _resp_count);
+    TEST_ASSERT_EQUAL_INT(GCOAP_MEMO_RESP, _resp_state);
+    TEST_ASSERT_EQUAL_INT(1, _resp_context);
+    TEST_ASSERT(_resp_remote);
+    TEST_ASSERT_EQUAL_INT(0, gcoap_op_state());
+
+    /* the memo is released, a second response is not matched */
+    _resp_inject(&_remote, 0x11);
+    TEST_ASSERT_EQUAL_INT(1, _resp_count);
+}
+
+/*
+ * A request without response expires after CONFIG_GCOAP_NON_TIMEOUT.
+ */
+static void test_gcoap__memo_req_expire(void)
+{
+    TEST_ASSERT(_req_send(0x21, 2) > 0);
+    TEST_ASSERT_EQUAL_INT(1, gcoap_op_state());
+
+    xtimer_usleep(2 * CONFIG_GCOAP_NON_TIMEOUT);
+    TEST_ASSERT_EQUAL_INT(1, _resp_count);
+    TEST_ASSERT_EQUAL_INT(GCOAP_MEMO_TIMEOUT, _resp_state);
+    TEST_ASSERT_EQUAL_INT(2, _resp_context);
+    TEST_ASSERT(!_resp_remote);
+    TEST_ASSERT_EQUAL_INT(0, gcoap_op_state());
+
+    /* a late response is not matched */
+    _resp_inject(&_remote, 0x21);
+    TEST_ASSERT_EQUAL_INT(1, _resp_count);
+}
+
+/*
+ * Requests are dropped while all memos are in use, a memo released by a
+ * response is taken by the next request.
+ */
+static void test_gcoap__memo_req_reuse(void)
+{
+    for (unsigned i = 1; i <= CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        TEST_ASSERT(_req_send(i, i) > 0);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GCOAP_REQ_WAITING_MAX, gcoap_op_state());
+    TEST_ASSERT_EQUAL_INT(0, _req_send(0xff, 0xff));
+
+    _resp_inject(&_remote, 1);
+    TEST_ASSERT_EQUAL_INT(1, _resp_count);
+    TEST_ASSERT_EQUAL_INT(1, _resp_context);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GCOAP_REQ_WAITING_MAX - 1, gcoap_op_state());
+    TEST_ASSERT(_req_send(0xff, 0xff) > 0);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GCOAP_REQ_WAITING_MAX, gcoap_op_state());
+
+    /* each open request is still matched by its own token */
+    _resp_inject(&_remote, 0xff);
+    TEST_ASSERT_EQUAL_INT(2, _resp_count);
+    TEST_ASSERT_EQUAL_INT(0xff, _resp_context);
+    for (unsigned i = 2; i <= CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        _resp_inject(&_remote, i);
+        TEST_ASSERT_EQUAL_INT(i + 1, _resp_count);
+        TEST_ASSERT_EQUAL_INT(i, _resp_context);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gcoap_op_state());
+}
+
+/*
+ * An Observe registration is found by resource for notifications and by
+ * client and token for re-registration and deregistration.
+ */
+static void test_gcoap__memo_obs_register(void)
+{
+    _expect_no_obs(&resources_obs[0]);
+    _obs_req("/obs/a", 0x31, COAP_OBS_REGISTER);
+    _expect_obs(&resources_obs[0], 0x31);
+    _expect_no_obs(&resources_obs[1]);
+
+    /* the client switches to a new token */
+    _obs_req("/obs/a", 0x32, COAP_OBS_REGISTER);
+    _expect_obs(&resources_obs[0], 0x32);
+
+    /* the old token is not registered anymore */
+    _obs_req("/obs/a", 0x31, COAP_OBS_DEREGISTER);
+    _expect_obs(&resources_obs[0], 0x32);
+
+    _obs_req("/obs/a", 0x32, COAP_OBS_DEREGISTER);
+    _expect_no_obs(&resources_obs[0]);
+}
+
+/*
+ * Registrations are rejected while all memos are in use, a memo released by
+ * a deregistration is taken by the next registration.
+ */
+static void test_gcoap__memo_obs_reuse(void)
+{
+    static_assert(CONFIG_GCOAP_OBS_REGISTRATIONS_MAX < ARRAY_SIZE(resources_obs),
+                  "more Observe registrations than resources");
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        _obs_req(resources_obs[i].path, 0x41 + i, COAP_OBS_REGISTER);
+        _expect_obs(&resources_obs[i], 0x41 + i);
+    }
+    _obs_req("/obs/c", 0x4f, COAP_OBS_REGISTER);
+    _expect_no_obs(&resources_obs[2]);
+
+    _obs_req("/obs/a", 0x41, COAP_OBS_DEREGISTER);
+    _expect_no_obs(&resources_obs[0]);
+    _obs_req("/obs/c", 0x4f, COAP_OBS_REGISTER);
+    _expect_obs(&resources_obs[2], 0x4f);
+
+    /* the remaining registrations are still indexed by their token */
+    for (unsigned i = 1; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        _expect_obs(&resources_obs[i], 0x41 + i);
+        _obs_req(resources_obs[i].path, 0x41 + i, COAP_OBS_DEREGISTER);
+        _expect_no_obs(&resources_obs[i]);
+    }
+    _obs_req("/obs/c", 0x4f, COAP_OBS_DEREGISTER);
+    _expect_no_obs(&resources_obs[2]);
+}
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -406,8 +765,34 @@ Test *tests_gcoap_tests(void)
     return (Test *)&gcoap_tests;
 }
 
+Test *tests_gcoap_memo_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gcoap__memo_req_match),
+        new_TestFixture(test_gcoap__memo_req_expire),
+        new_TestFixture(test_gcoap__memo_req_reuse),
+        new_TestFixture(test_gcoap__memo_obs_register),
+        new_TestFixture(test_gcoap__memo_obs_reuse),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_memo_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gcoap_memo_tests;
+}
+
 void tests_gcoap(void)
 {
     TESTS_RUN(tests_gcoap_tests());
+
+    /* the memo tests exchange messages with the gcoap thread */
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gnrc_pktbuf_init();
+    gcoap_init();
+    gnrc_netreg_entry_init_pid(&_udp_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_udp_reg);
+    gcoap_register_listener(&listener_obs);
+    TESTS_RUN(tests_gcoap_memo_tests());
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_udp_reg);
 }
 /** @} */
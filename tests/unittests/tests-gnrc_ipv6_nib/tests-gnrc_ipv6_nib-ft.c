@@ -30,6 +30,9 @@
 #define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
 #define L2ADDR              { 0x90, 0xd5, 0x8e, 0x8c, 0x92, 0x43, 0x73, 0x5c }
 #define GLOBAL_PREFIX_LEN   (30)
+/* has set bits between all prefix lengths in _nested_lens, so every shorter
+ * prefix matches fewer bits of the address */
+#define NESTED_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0xca, 0xfe, 0xbe, 0xef }
 #define IFACE               (6)
 
 static void set_up(void)
@@ -39,7 +42,7 @@ static void set_up(void)
     for (evtimer_event_t *ptr = _nib_evtimer.events;
          (ptr != NULL) && (tmp = (ptr->next), 1);
          ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+        _evtimer_del((evtimer_msg_event_t *)ptr);
     }
     _nib_init();
 }
@@ -178,6 +181,72 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/* prefix lengths of the nested routes to NESTED_PREFIX, in insertion order */
+static const unsigned _nested_lens[] = { 48, 16, 64, GLOBAL_PREFIX_LEN };
+
+static void _next_hop_for(ipv6_addr_t *next_hop, unsigned dst_len)
+{
+    static const ipv6_addr_t base = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                               { .u64 = TEST_UINT64 } } };
+
+    memcpy(next_hop, &base, sizeof(*next_hop));
+    next_hop->u8[15] += dst_len;
+}
+
+static void _add_nested_route(unsigned dst_len)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = NESTED_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop;
+
+    _next_hop_for(&next_hop, dst_len);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, dst_len, &next_hop,
+                                                  IFACE, 0));
+}
+
+/* gets the route for NESTED_PREFIX with bit @p flip toggled (none if 128)
+ * and expects it to be the nested route of length @p dst_len (none if 0) */
+static void _expect_nested_route(unsigned flip, unsigned dst_len)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst = { .u64 = { { .u8 = NESTED_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop;
+
+    if (flip < IPV6_ADDR_BIT_LEN) {
+        bf_toggle(dst.u8, flip);
+    }
+    if (dst_len == 0) {
+        TEST_ASSERT_EQUAL_INT(-ENETUNREACH,
+                              gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        return;
+    }
+    _next_hop_for(&next_hop, dst_len);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(dst_len, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_match_prefix(&dst, &fte.dst) >= dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+}
+
+/*
+ * Adds four routes with nested prefixes of different lengths in unsorted
+ * order, then tries to get addresses that diverge from them at different bits.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route with the longest
+ * matching prefix or -ENETUNREACH if none matches
+ */
+static void test_nib_ft_get__success_longest_prefix(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_nested_lens); i++) {
+        _add_nested_route(_nested_lens[i]);
+    }
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 64);
+    _expect_nested_route(60, 48);
+    _expect_nested_route(40, GLOBAL_PREFIX_LEN);
+    _expect_nested_route(GLOBAL_PREFIX_LEN - 1, 16);
+    _expect_nested_route(20, 16);
+    _expect_nested_route(8, 0);
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -639,6 +708,89 @@ static void test_nib_ft_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL ,0, &iter_state, &fte));
 }
 
+/*
+ * Adds four routes with nested prefixes, then removes and re-adds some of
+ * them.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the longest matching
+ * prefix among the remaining routes
+ */
+static void test_nib_ft_del__overlapping(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = NESTED_PREFIX } } };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_nested_lens); i++) {
+        _add_nested_route(_nested_lens[i]);
+    }
+    /* remove a prefix in the middle */
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 64);
+    _expect_nested_route(60, 48);
+    _expect_nested_route(40, 16);
+    _expect_nested_route(8, 0);
+    _add_nested_route(GLOBAL_PREFIX_LEN);
+    _expect_nested_route(40, GLOBAL_PREFIX_LEN);
+    /* remove the longest and the shortest prefix */
+    gnrc_ipv6_nib_ft_del(&dst, 64);
+    gnrc_ipv6_nib_ft_del(&dst, 16);
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 48);
+    _expect_nested_route(40, GLOBAL_PREFIX_LEN);
+    _expect_nested_route(20, 0);
+    _add_nested_route(16);
+    _add_nested_route(64);
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 64);
+    _expect_nested_route(20, 16);
+    /* remove all but the shortest prefix */
+    gnrc_ipv6_nib_ft_del(&dst, 48);
+    gnrc_ipv6_nib_ft_del(&dst, 64);
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 16);
+    gnrc_ipv6_nib_ft_del(&dst, 16);
+    _expect_nested_route(IPV6_ADDR_BIT_LEN, 0);
+}
+
+/*
+ * Adds two routes with the same prefix via different next hops and a route
+ * with a shorter prefix. Removes the first route, then re-adds it.
+ * Expected result: the second route takes over the prefix while the first one
+ * is removed, the re-added first route is preferred again
+ */
+static void test_nib_ft_del__same_prefix(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+    static const ipv6_addr_t next_hop3 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 2 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN - 1,
+                                                  &next_hop3, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    /* removes the first route */
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    /* takes the slot of the first route again */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop3, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN - 1, fte.dst_len);
+}
+
 /**
  * Creates three default routes and removes the first one.
  * The prefix list is then iterated.
@@ -727,6 +879,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success_longest_prefix),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -748,6 +901,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_add__success_dr),
         new_TestFixture(test_nib_ft_del__unknown),
         new_TestFixture(test_nib_ft_del__success),
+        new_TestFixture(test_nib_ft_del__overlapping),
+        new_TestFixture(test_nib_ft_del__same_prefix),
         /* most of gnrc_ipv6_nib_ft_iter() is tested during all the tests above */
         new_TestFixture(test_nib_ft_iter__empty_def_route_at_beginning),
         new_TestFixture(test_nib_ft_iter__empty_pref_route_in_the_middle),
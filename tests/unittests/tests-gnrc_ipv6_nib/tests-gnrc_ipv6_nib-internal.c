@@ -1949,6 +1949,113 @@ static void test_nib_abr_iter__three_elem_middle_removed(void)
 }
 #endif
 
+/*
+ * Schedules the NUD timeouts of two neighbor cache entries and extends the
+ * first one beyond the second.
+ * Expected result: the first event stays the head of the event timer and is
+ * only marked as postponed. When it fires early it is scheduled again for the
+ * rest of the time.
+ */
+static void test_evtimer_add_until__postpone(void)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    _nib_onl_entry_t *node1, *node2;
+    uint32_t remaining;
+
+    TEST_ASSERT_NOT_NULL((node1 = _nib_nc_add(&addr, IFACE,
+                                              GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    addr.u64[1].u64++;
+    TEST_ASSERT_NOT_NULL((node2 = _nib_nc_add(&addr, IFACE,
+                                              GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    _evtimer_add_until(node1, GNRC_IPV6_NIB_REACH_TIMEOUT, &node1->nud_timeout,
+                       &node1->nud_timeout_until, TEST_UINT16);
+    _evtimer_add_until(node2, GNRC_IPV6_NIB_REACH_TIMEOUT, &node2->nud_timeout,
+                       &node2->nud_timeout_until, 2 * TEST_UINT16);
+    TEST_ASSERT((evtimer_event_t *)&node1->nud_timeout == _nib_evtimer.events);
+
+    _evtimer_add_until(node1, GNRC_IPV6_NIB_REACH_TIMEOUT, &node1->nud_timeout,
+                       &node1->nud_timeout_until, 3 * TEST_UINT16);
+    TEST_ASSERT((evtimer_event_t *)&node1->nud_timeout == _nib_evtimer.events);
+    remaining = _evtimer_lookup(&node1->nud_timeout, node1->nud_timeout_until,
+                                GNRC_IPV6_NIB_REACH_TIMEOUT);
+    TEST_ASSERT(remaining > 2 * TEST_UINT16);
+    TEST_ASSERT(remaining <= 3 * TEST_UINT16);
+
+    /* let the event leave the event timer as if it fired */
+    _evtimer_del(&node1->nud_timeout);
+    TEST_ASSERT((evtimer_event_t *)&node2->nud_timeout == _nib_evtimer.events);
+    TEST_ASSERT(_evtimer_postponed(node1, GNRC_IPV6_NIB_REACH_TIMEOUT));
+    TEST_ASSERT((evtimer_event_t *)&node2->nud_timeout == _nib_evtimer.events);
+    TEST_ASSERT((evtimer_event_t *)&node1->nud_timeout == _nib_evtimer.events->next);
+    TEST_ASSERT(_evtimer_lookup(&node1->nud_timeout, node1->nud_timeout_until,
+                                GNRC_IPV6_NIB_REACH_TIMEOUT) > 2 * TEST_UINT16);
+
+    /* moving an event to an earlier time moves it in the event timer */
+    _evtimer_add_until(node1, GNRC_IPV6_NIB_REACH_TIMEOUT, &node1->nud_timeout,
+                       &node1->nud_timeout_until, TEST_UINT16);
+    TEST_ASSERT((evtimer_event_t *)&node1->nud_timeout == _nib_evtimer.events);
+
+    _evtimer_del(&node1->nud_timeout);
+    _evtimer_del(&node2->nud_timeout);
+    TEST_ASSERT_NULL(_nib_evtimer.events);
+}
+
+/*
+ * Schedules the NUD timeout of a neighbor cache entry and cancels it.
+ * Expected result: the event stays in the event timer, but is not found by
+ * _evtimer_lookup() and not due. Adding it again does not add it twice.
+ */
+static void test_evtimer_cancel(void)
+{
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+    _nib_onl_entry_t *node;
+
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    _evtimer_add_until(node, GNRC_IPV6_NIB_SND_MC_NS, &node->nud_timeout,
+                       &node->nud_timeout_until, TEST_UINT16);
+    _evtimer_cancel(&node->nud_timeout);
+    TEST_ASSERT(_evtimer_listed(&node->nud_timeout));
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX,
+                          _evtimer_lookup(&node->nud_timeout,
+                                          node->nud_timeout_until,
+                                          GNRC_IPV6_NIB_SND_MC_NS));
+
+    _evtimer_add(node, GNRC_IPV6_NIB_SND_UC_NS, &node->nud_timeout,
+                 2 * TEST_UINT16);
+    TEST_ASSERT((evtimer_event_t *)&node->nud_timeout == _nib_evtimer.events);
+    TEST_ASSERT_NULL(_nib_evtimer.events->next);
+
+    /* removal takes the event out of the event timer */
+    _nib_nc_remove(node);
+    TEST_ASSERT(!_evtimer_listed(&node->nud_timeout));
+    TEST_ASSERT_NULL(_nib_evtimer.events);
+}
+
+/*
+ * Schedules an event further in the future than evtimer can handle.
+ * Expected result: the offset is truncated to INT32_MAX.
+ */
+static void test_evtimer_add_until__truncate(void)
+{
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+    _nib_onl_entry_t *node;
+    uint32_t remaining;
+
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    _evtimer_add_until(node, GNRC_IPV6_NIB_REACH_TIMEOUT, &node->nud_timeout,
+                       &node->nud_timeout_until, UINT32_MAX);
+    remaining = _evtimer_lookup(&node->nud_timeout, node->nud_timeout_until,
+                                GNRC_IPV6_NIB_REACH_TIMEOUT);
+    TEST_ASSERT(remaining <= INT32_MAX);
+    TEST_ASSERT(remaining > INT32_MAX - TEST_UINT16);
+    _evtimer_del(&node->nud_timeout);
+}
+
 static void test_retrans_exp_backoff(void)
 {
     TEST_ASSERT_EQUAL_INT(0,
@@ -2100,6 +2207,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_abr_iter__three_elem),
         new_TestFixture(test_nib_abr_iter__three_elem_middle_removed),
 #endif
+        new_TestFixture(test_evtimer_add_until__postpone),
+        new_TestFixture(test_evtimer_cancel),
+        new_TestFixture(test_evtimer_add_until__truncate),
         new_TestFixture(test_retrans_exp_backoff),
     };
 
@@ -38,7 +38,7 @@ static void set_up(void)
     for (evtimer_event_t *ptr = _nib_evtimer.events;
          (ptr != NULL) && (tmp = (ptr->next), 1);
          ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+        _evtimer_del((evtimer_msg_event_t *)ptr);
     }
     _nib_init();
 }
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "msg.h"
+#include "thread.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/tcp.h"
+#include "utlist.h"
+#ifdef MODULE_GNRC_IPV6
+#include "net/gnrc/ipv6/hdr.h"
+#endif
+
+#include "internal/common.h"
+#include "internal/fsm.h"
+#include "internal/option.h"
+
+#include "tests-gnrc_tcp.h"
+
+#define LOCAL_PORT      (2342U)
+#define PEER_PORT       (4242U)
+#define ISS             (1000U)
+#define IRS             (5000U)
+#define WND             (1000U)
+#define MSS             (100U)
+#define SEGMENTS        (3U)
+
+/* sequence number of the n-th segment in flight */
+#define SEG(n)          (ISS + 1 + ((n) * MSS))
+
+/* the segments sent by TCP end up in the message queue of the test thread */
+#define MSG_QUEUE_SIZE  (8U)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _data[SEGMENTS * MSS];
+
+/* collects the sequence numbers of the segments handed down by TCP */
+static unsigned _sent(uint32_t *seq, unsigned max)
+{
+    unsigned num = 0;
+    msg_t msg;
+
+    while (msg_try_receive(&msg) > 0) {
+        gnrc_pktsnip_t *pkt = msg.content.ptr;
+        gnrc_pktsnip_t *tcp;
+
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_SND) {
+            continue;
+        }
+        LL_SEARCH_SCALAR(pkt, tcp, type, GNRC_NETTYPE_TCP);
+        if ((tcp != NULL) && (num < max)) {
+            seq[num] = byteorder_ntohl(((tcp_hdr_t *)tcp->data)->seq_num);
+        }
+        gnrc_pktbuf_release(pkt);
+        num++;
+    }
+    return num;
+}
+
+/* passes an ACK from the peer to TCP, with a SACK block if @p sack is given */
+static void _receive(uint32_t seq, uint32_t ack, const uint32_t *sack)
+{
+    uint8_t buf[sizeof(tcp_hdr_t) + 12];
+    tcp_hdr_t *hdr = (tcp_hdr_t *)buf;
+    uint16_t offset = TCP_HDR_OFFSET_MIN;
+    gnrc_pktsnip_t *pkt;
+
+    memset(buf, 0, sizeof(buf));
+    hdr->src_port = byteorder_htons(PEER_PORT);
+    hdr->dst_port = byteorder_htons(LOCAL_PORT);
+    hdr->seq_num = byteorder_htonl(seq);
+    hdr->ack_num = byteorder_htonl(ack);
+    hdr->window = byteorder_htons(WND);
+    if (sack != NULL) {
+        uint8_t *opt = &buf[sizeof(tcp_hdr_t)];
+        network_uint32_t edge;
+
+        opt[0] = TCP_OPTION_KIND_NOP;
+        opt[1] = TCP_OPTION_KIND_NOP;
+        opt[2] = TCP_OPTION_KIND_SACK;
+        opt[3] = TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK;
+        edge = byteorder_htonl(sack[0]);
+        memcpy(&opt[4], &edge, sizeof(edge));
+        edge = byteorder_htonl(sack[1]);
+        memcpy(&opt[8], &edge, sizeof(edge));
+        offset += 3;
+    }
+    hdr->off_ctl = byteorder_htons(_option_build_offset_control(offset, MSK_ACK));
+
+    pkt = gnrc_pktbuf_add(NULL, buf, offset * 4, GNRC_NETTYPE_TCP);
+    TEST_ASSERT_NOT_NULL(pkt);
+#ifdef MODULE_GNRC_IPV6
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, NULL);
+    TEST_ASSERT_NOT_NULL(pkt);
+#endif
+    _fsm(&_tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_tcp_tcb_init(&_tcb);
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _tcb.local_port = LOCAL_PORT;
+    _tcb.peer_port = PEER_PORT;
+    _tcb.iss = ISS;
+    _tcb.snd_una = ISS + 1;
+    _tcb.snd_nxt = ISS + 1;
+    _tcb.snd_wnd = WND;
+    _tcb.snd_wl1 = IRS;
+    _tcb.snd_wl2 = ISS + 1;
+    _tcb.irs = IRS;
+    _tcb.rcv_nxt = IRS + 1;
+    _tcb.rcv_wnd = WND;
+    _tcb.mss = MSS;
+    _tcb.status |= STATUS_SACK_PERMITTED;
+
+    /* put three segments in flight */
+    _fsm(&_tcb, FSM_EVENT_CALL_SEND, NULL, _data, sizeof(_data));
+}
+
+static void tear_down(void)
+{
+    _fsm(&_tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+    _sent(NULL, 0);
+}
+
+static void test_gnrc_tcp__send(void)
+{
+    uint32_t seq[SEGMENTS];
+
+    TEST_ASSERT_EQUAL_INT(SEGMENTS, _tcb.pkt_retransmit_numof);
+    TEST_ASSERT_EQUAL_INT(SEGMENTS, _sent(seq, SEGMENTS));
+    for (unsigned i = 0; i < SEGMENTS; i++) {
+        TEST_ASSERT_EQUAL_INT(SEG(i), seq[i]);
+    }
+}
+
+static void test_gnrc_tcp_sack__acceptable(void)
+{
+    const uint32_t sack[] = { SEG(1), SEG(2) };
+
+    _sent(NULL, 0);
+    _receive(IRS + 1, SEG(0), sack);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.dup_acks);
+}
+
+static void test_gnrc_tcp_sack__unacceptable(void)
+{
+    const uint32_t sack[] = { SEG(1), SEG(2) };
+
+    _sent(NULL, 0);
+    /* outside of the receive window, TCP only answers with an ACK */
+    _receive(IRS + 1 + 2 * WND, SEG(0), sack);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.dup_acks);
+    TEST_ASSERT_EQUAL_INT(1, _sent(NULL, 0));
+}
+
+static void test_gnrc_tcp_sack__new_ack(void)
+{
+    const uint32_t sack[] = { SEG(2), SEG(3) };
+
+    _sent(NULL, 0);
+    /* the first segment is acknowledged, the last one is SACKed */
+    _receive(IRS + 1, SEG(1), sack);
+    TEST_ASSERT_EQUAL_INT(SEGMENTS - 1, _tcb.pkt_retransmit_numof);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.dup_acks);
+}
+
+static void test_gnrc_tcp_fast_retransmit(void)
+{
+    const uint32_t sack[] = { SEG(2), SEG(3) };
+    uint32_t seq[SEGMENTS];
+
+    _sent(NULL, 0);
+    for (unsigned i = 1; i < TCP_DUP_ACK_THRESHOLD; i++) {
+        _receive(IRS + 1, SEG(0), sack);
+        TEST_ASSERT_EQUAL_INT(0, _sent(NULL, 0));
+    }
+    _receive(IRS + 1, SEG(0), sack);
+    /* only the holes before the SACKed segment are sent again */
+    TEST_ASSERT_EQUAL_INT(2, _sent(seq, SEGMENTS));
+    TEST_ASSERT_EQUAL_INT(SEG(0), seq[0]);
+    TEST_ASSERT_EQUAL_INT(SEG(1), seq[1]);
+}
+
+static void test_gnrc_tcp_fast_retransmit__dup_acks_saturate(void)
+{
+    uint32_t seq[SEGMENTS];
+    unsigned num = 0;
+
+    _sent(NULL, 0);
+    for (unsigned i = 0; i < 2 * UINT8_MAX; i++) {
+        _receive(IRS + 1, SEG(0), NULL);
+        num += _sent(seq, SEGMENTS);
+    }
+    TEST_ASSERT_EQUAL_INT(UINT8_MAX, _tcb.dup_acks);
+    /* without SACK information only the oldest segment is sent, once */
+    TEST_ASSERT_EQUAL_INT(1, num);
+    TEST_ASSERT_EQUAL_INT(SEG(0), seq[0]);
+}
+
+Test *tests_gnrc_tcp_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp__send),
+        new_TestFixture(test_gnrc_tcp_sack__acceptable),
+        new_TestFixture(test_gnrc_tcp_sack__unacceptable),
+        new_TestFixture(test_gnrc_tcp_sack__new_ack),
+        new_TestFixture(test_gnrc_tcp_fast_retransmit),
+        new_TestFixture(test_gnrc_tcp_fast_retransmit__dup_acks_saturate),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_tests;
+}
+
+void tests_gnrc_tcp(void)
+{
+    /* TCP hands its segments to the test thread */
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gnrc_tcp_pid = thread_getpid();
+    TESTS_RUN(tests_gnrc_tcp_tests());
+}
+/** @} */
@@ -153,6 +153,25 @@ static const unsigned char h_fips_multiblock[] =
                                      0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
                                      0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1};
 
+/**
+ * @brief expected hash for one million repetitions of "a"
+ *        (from FIPS 180-2 Appendix B.3)
+ */
+static const unsigned char h_fips_million_a[] =
+                                    {0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92,
+                                     0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+                                     0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+                                     0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0};
+
+static const char long_sequence[] = {
+    "RIOT is an open-source microkernel-based operating system, designed"
+    " to match the requirements of Internet of Things (IoT) devices and"
+    " other embedded devices. These requirements include a very low memory"
+    " footprint (on the order of a few kilobytes), high energy efficiency"
+    ", real-time capabilities, communication stacks for both wireless and"
+    " wired networks, and support for a wide range of low-power hardware."
+};
+
 static int calc_and_compare_hash(const char *str, const unsigned char *expected)
 {
     static unsigned char hash[SHA256_DIGEST_LENGTH];
@@ -241,14 +260,32 @@ static void test_hashes_sha256_hash_sequence_failing_compare(void)
 
 static void test_hashes_sha256_hash_long_sequence(void)
 {
-    char *teststring = {"RIOT is an open-source microkernel-based operating system, designed"
-                       " to match the requirements of Internet of Things (IoT) devices and"
-                       " other embedded devices. These requirements include a very low memory"
-                       " footprint (on the order of a few kilobytes), high energy efficiency"
-                       ", real-time capabilities, communication stacks for both wireless and"
-                       " wired networks, and support for a wide range of low-power hardware."};
-    TEST_ASSERT(calc_and_compare_hash(teststring, hlong_sequence));
-    TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, hlong_sequence));
+    TEST_ASSERT(calc_and_compare_hash(long_sequence, hlong_sequence));
+    TEST_ASSERT(calc_and_compare_hash_wrapper(long_sequence, hlong_sequence));
+}
+
+static void test_hashes_sha256_hash_long_sequence_split(void)
+{
+    static unsigned char buf[sizeof(long_sequence) + 3];
+    static unsigned char hash[SHA256_DIGEST_LENGTH];
+    const size_t len = strlen(long_sequence);
+    sha256_context_t sha256;
+
+    /* feed the input from unaligned addresses in chunks that cross block
+     * boundaries at every possible offset */
+    for (unsigned offset = 1; offset < 4; offset++) {
+        memcpy(&buf[offset], long_sequence, len);
+        for (size_t chunk = 1; chunk <= 130; chunk += 3) {
+            sha256_init(&sha256);
+            for (size_t pos = 0; pos < len; pos += chunk) {
+                size_t n = (len - pos < chunk) ? len - pos : chunk;
+                sha256_update(&sha256, &buf[offset + pos], n);
+            }
+            sha256_final(&sha256, hash);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(hlong_sequence, hash,
+                                            SHA256_DIGEST_LENGTH));
+        }
+    }
 }
 
 static void test_hashes_sha256_hash_sequence_abc(void)
@@ -265,6 +302,22 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_hash_million_a(void)
+{
+    static unsigned char buf[1000];
+    static unsigned char hash[SHA256_DIGEST_LENGTH];
+    sha256_context_t sha256;
+
+    memset(buf, 'a', sizeof(buf));
+    sha256_init(&sha256);
+    for (unsigned i = 0; i < 1000; i++) {
+        sha256_update(&sha256, buf, sizeof(buf));
+    }
+    sha256_final(&sha256, hash);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(h_fips_million_a, hash,
+                                    SHA256_DIGEST_LENGTH));
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -280,9 +333,11 @@ Test *tests_hashes_sha256_tests(void)
         new_TestFixture(test_hashes_sha256_hash_sequence_failing_compare),
 
         new_TestFixture(test_hashes_sha256_hash_long_sequence),
+        new_TestFixture(test_hashes_sha256_hash_long_sequence_split),
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+        new_TestFixture(test_hashes_sha256_hash_million_a),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
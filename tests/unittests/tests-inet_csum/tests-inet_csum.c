@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,25 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* same data as in test_inet_csum__calculate_csum() */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+    uint8_t buf[sizeof(data) + 3];
+
+    /* the result must not depend on the alignment of the buffer */
+    for (unsigned offset = 0; offset < 4; offset++) {
+        memcpy(&buf[offset], data, sizeof(data) - 3 + offset);
+        TEST_ASSERT_EQUAL_INT(inet_csum_slice_bytewise(0, data, sizeof(data) - 3 + offset, 0),
+                              inet_csum(0, &buf[offset], sizeof(data) - 3 + offset));
+    }
+    TEST_ASSERT_EQUAL_INT(0x479e, inet_csum(0, &buf[3], sizeof(data)));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +196,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -102,12 +102,23 @@ static int power(mtd_dev_t *dev, enum mtd_power_state power)
     return 0;
 }
 
+static unsigned flush_calls;
+
+static int flush(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    flush_calls++;
+    return 0;
+}
+
 static const mtd_desc_t driver = {
     .init = init,
     .read = read,
     .write = write,
     .erase = erase,
     .power = power,
+    .flush = flush,
 };
 
 static mtd_dev_t _dev = {
@@ -240,6 +251,21 @@ static void test_mtd_write_read(void)
     TEST_ASSERT_EQUAL_INT(-EOVERFLOW, ret);
 }
 
+static void test_mtd_flush(void)
+{
+#ifndef MTD_0
+    unsigned calls = flush_calls;
+#endif
+    int ret = mtd_flush(dev);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+#ifndef MTD_0
+    TEST_ASSERT_EQUAL_INT(calls + 1, flush_calls);
+#endif
+
+    ret = mtd_flush(NULL);
+    TEST_ASSERT_EQUAL_INT(-ENODEV, ret);
+}
+
 #ifdef MTD_0
 static void test_mtd_write_read_flash(void)
 {
@@ -286,11 +312,22 @@ static void test_mtd_vfs(void)
     TEST_ASSERT_EQUAL_INT(0, memcmp(buf_empty, buf_read, sizeof(buf_empty)));
     TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read + sizeof(buf_empty), sizeof(buf)));
 
+#ifndef MTD_0
+    unsigned calls = flush_calls;
+#endif
+    ret = vfs_fsync(fd);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+#ifndef MTD_0
+    TEST_ASSERT_EQUAL_INT(calls + 1, flush_calls);
+#endif
+
     ret = vfs_lseek(fd, 0, SEEK_END);
     TEST_ASSERT(ret > 0);
     ret = vfs_write(fd, buf, sizeof(buf));
     /* Attempted to write past the device memory */
     TEST_ASSERT(ret < 0);
+
+    vfs_close(fd);
 }
 #endif
 
@@ -301,6 +338,7 @@ Test *tests_mtd_tests(void)
         new_TestFixture(test_mtd_erase),
         new_TestFixture(test_mtd_write_erase),
         new_TestFixture(test_mtd_write_read),
+        new_TestFixture(test_mtd_flush),
 #ifdef MTD_0
         new_TestFixture(test_mtd_write_read_flash),
 #endif
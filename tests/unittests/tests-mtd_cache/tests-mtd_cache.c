@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#include "tests-mtd_cache.h"
+
+#define SECTOR_COUNT        (8U)
+#define PAGE_PER_SECTOR     (4U)
+#define PAGE_SIZE           (64U)
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_COUNT * SECTOR_SIZE)
+
+/* RAM-based flash mock: writing clears bits, erasing sets them */
+static uint8_t _memory[MEMORY_SIZE];
+static unsigned _reads;
+static unsigned _writes;
+static uint32_t _write_addr;
+static uint32_t _write_size;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if (addr + size > sizeof(_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, &_memory[addr], size);
+    _reads++;
+
+    return 0;
+}
+
+static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr,
+                  uint32_t size)
+{
+    const uint8_t *src = buff;
+
+    if (addr + size > sizeof(_memory)) {
+        return -EOVERFLOW;
+    }
+    if (((addr % dev->page_size) + size) > dev->page_size) {
+        return -EOVERFLOW;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        _memory[addr + i] &= src[i];
+    }
+    _writes++;
+    _write_addr = addr;
+    _write_size = size;
+
+    return 0;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if ((addr % SECTOR_SIZE != 0) || (size % SECTOR_SIZE != 0)) {
+        return -EOVERFLOW;
+    }
+    if (addr + size > sizeof(_memory)) {
+        return -EOVERFLOW;
+    }
+    memset(&_memory[addr], 0xff, size);
+
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read = _read,
+    .write = _write,
+    .erase = _erase,
+};
+
+static mtd_dev_t _flash = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_flash);
+static mtd_dev_t *dev = &_cache.mtd;
+
+static void setup(void)
+{
+    mtd_init(dev);
+    /* drops all cached pages */
+    mtd_erase(dev, 0, MEMORY_SIZE);
+    memset(&_cache.stats, 0, sizeof(_cache.stats));
+    _reads = 0;
+    _writes = 0;
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, dev->page_size);
+    TEST_ASSERT(mtd_cache_iter(NULL) == &_cache);
+}
+
+static void test_mtd_cache_init__page_too_large(void)
+{
+    mtd_dev_t flash = {
+        .driver = &_driver,
+        .sector_count = 1,
+        .pages_per_sector = 1,
+        .page_size = CONFIG_MTD_CACHE_PAGE_SIZE * 2,
+    };
+    mtd_cache_t cache = MTD_CACHE_INIT(&flash);
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, mtd_init(&cache.mtd));
+    TEST_ASSERT(mtd_cache_iter(&_cache) == NULL);
+}
+
+static void test_mtd_cache_write_back(void)
+{
+    const uint8_t buf[] = { 0x01, 0x02, 0x03, 0x04 };
+    uint8_t buf_read[sizeof(buf)];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, PAGE_SIZE + 8, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(1, mtd_cache_dirty(&_cache));
+    TEST_ASSERT_EQUAL_INT(0xff, _memory[PAGE_SIZE + 8]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf_read, PAGE_SIZE + 8,
+                                      sizeof(buf_read)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.hits);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_dirty(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.writebacks);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, &_memory[PAGE_SIZE + 8], sizeof(buf)));
+
+    /* a clean cache writes nothing */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+}
+
+static void test_mtd_cache_dirty_range(void)
+{
+    const uint8_t buf[] = { 0xa5, 0xa5 };
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, 2 * PAGE_SIZE + 30,
+                                       sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, 2 * PAGE_SIZE + 10,
+                                       sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+
+    /* only the modified bytes are programmed, in one operation */
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(2 * PAGE_SIZE + 10, _write_addr);
+    TEST_ASSERT_EQUAL_INT(30 + sizeof(buf) - 10, _write_size);
+    TEST_ASSERT_EQUAL_INT(0xa5, _memory[2 * PAGE_SIZE + 11]);
+    TEST_ASSERT_EQUAL_INT(0xff, _memory[2 * PAGE_SIZE + 12]);
+    TEST_ASSERT_EQUAL_INT(0xa5, _memory[2 * PAGE_SIZE + 30]);
+}
+
+static void test_mtd_cache_write_and(void)
+{
+    const uint8_t first[] = { 0xf0, 0xee };
+    const uint8_t second[] = { 0x3c, 0x77 };
+    const uint8_t expected[] = { 0x30, 0x66 };
+    uint8_t page[PAGE_SIZE];
+    uint8_t buf_read[sizeof(expected)];
+
+    /* programmed on the device before the page is cached */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(&_flash, first, 0, sizeof(first)));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, second, 0, sizeof(second)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf_read, 0, sizeof(buf_read)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, buf_read, sizeof(expected)));
+
+    /* full page writes are merged with the stored data, too */
+    memset(page, 0xff, sizeof(page));
+    page[sizeof(page) - 1] = 0x0f;
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, page, 0, sizeof(page)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, page, 0, sizeof(page)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, page, sizeof(expected)));
+    TEST_ASSERT_EQUAL_INT(0x0f, page[sizeof(page) - 1]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, _memory, sizeof(expected)));
+    TEST_ASSERT_EQUAL_INT(0x0f, _memory[PAGE_SIZE - 1]);
+}
+
+static void test_mtd_cache_eviction(void)
+{
+    const uint8_t buf[] = { 0x00 };
+
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, i * PAGE_SIZE,
+                                           sizeof(buf)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINES, mtd_cache_dirty(&_cache));
+
+    /* page 0 becomes the most recently used one, page 1 is replaced */
+    uint8_t tmp;
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, &tmp, 0, sizeof(tmp)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf,
+                                       CONFIG_MTD_CACHE_LINES * PAGE_SIZE,
+                                       sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _write_addr);
+    TEST_ASSERT_EQUAL_INT(0, _memory[PAGE_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0xff, _memory[0]);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINES, mtd_cache_dirty(&_cache));
+
+    /* the evicted page is read from the device again */
+    unsigned reads = _reads;
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, &tmp, PAGE_SIZE, sizeof(tmp)));
+    TEST_ASSERT_EQUAL_INT(reads + 1, _reads);
+    TEST_ASSERT_EQUAL_INT(0, tmp);
+}
+
+static void test_mtd_cache_erase(void)
+{
+    const uint8_t buf[] = { 0x12, 0x34 };
+    uint8_t buf_read[sizeof(buf)];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, SECTOR_SIZE + 4,
+                                       sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, 4, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, SECTOR_SIZE, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, mtd_cache_dirty(&_cache));
+
+    /* the pending write to the erased sector is dropped */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(4, _write_addr);
+    TEST_ASSERT_EQUAL_INT(0xff, _memory[SECTOR_SIZE + 4]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf_read, SECTOR_SIZE + 4,
+                                      sizeof(buf_read)));
+    TEST_ASSERT_EQUAL_INT(0xff, buf_read[0]);
+    TEST_ASSERT_EQUAL_INT(0xff, buf_read[1]);
+}
+
+static void test_mtd_cache_overflow(void)
+{
+    const uint8_t buf[] = { 0x00, 0x00 };
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_write(dev, buf, PAGE_SIZE - 1,
+                                                sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_write(dev, buf, MEMORY_SIZE - 1,
+                                                sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_dirty(&_cache));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_init__page_too_large),
+        new_TestFixture(test_mtd_cache_write_back),
+        new_TestFixture(test_mtd_cache_dirty_range),
+        new_TestFixture(test_mtd_cache_write_and),
+        new_TestFixture(test_mtd_cache_eviction),
+        new_TestFixture(test_mtd_cache_erase),
+        new_TestFixture(test_mtd_cache_overflow),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+void tests_mtd_cache(void)
+{
+    TESTS_RUN(tests_mtd_cache_tests());
+}
+/** @} */
@@ -19,6 +19,7 @@
 
 #include "embUnit.h"
 
+#include "kernel_defines.h"
 #include "net/nanocoap.h"
 
 #include "unittests-constants.h"
@@ -836,6 +837,71 @@ static void test_nanocoap__token_length_over_limit(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
+/*
+ * Verifies the resource look-up of coap_find_resource() for exact and subtree
+ * matches, method filtering and resources sharing a path. path_found is only
+ * relevant if no resource was found.
+ */
+static void test_nanocoap__find_resource(void)
+{
+    static const coap_resource_t resources[] = {
+        { "/a",     COAP_GET,                       NULL, NULL },
+        { "/a",     COAP_PUT | COAP_MATCH_SUBTREE,  NULL, NULL },
+        { "/a/b",   COAP_GET,                       NULL, NULL },
+        { "/a/b",   COAP_GET | COAP_MATCH_SUBTREE,  NULL, NULL },
+        { "/a/bc",  COAP_POST,                      NULL, NULL },
+        { "/ab",    COAP_GET | COAP_POST,           NULL, NULL },
+        { "/b/",    COAP_GET | COAP_MATCH_SUBTREE,  NULL, NULL },
+        { "/c",     COAP_GET,                       NULL, NULL },
+    };
+    static const struct {
+        const char *uri;
+        coap_method_flags_t method;
+        int idx;
+        bool path_found;
+    } cases[] = {
+        { "/a",         COAP_GET,   0,  false },
+        { "/a",         COAP_PUT,   1,  false },
+        { "/a",         COAP_POST,  -1, true  },
+        { "/a/b",       COAP_GET,   2,  false },
+        { "/a/b/c",     COAP_GET,   3,  false },
+        { "/a/b/c",     COAP_PUT,   1,  false },
+        { "/a/bc",      COAP_GET,   3,  false },
+        { "/a/bc",      COAP_POST,  4,  false },
+        { "/a/bcd",     COAP_GET,   3,  false },
+        { "/a/bcd",     COAP_POST,  -1, true  },
+        { "/ab",        COAP_POST,  5,  false },
+        { "/abc",       COAP_GET,   -1, true  },
+        { "/abc",       COAP_PUT,   1,  false },
+        { "/b",         COAP_GET,   -1, false },
+        { "/b/",        COAP_GET,   6,  false },
+        { "/b/x/y",     COAP_GET,   6,  false },
+        { "/c/d",       COAP_GET,   -1, false },
+        { "/",          COAP_GET,   -1, false },
+        { "/0",         COAP_GET,   -1, false },
+        { "/z",         COAP_GET,   -1, false },
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(cases); i++) {
+        bool path_found = false;
+        const coap_resource_t *res;
+
+        res = coap_find_resource(resources, ARRAY_SIZE(resources),
+                                 (const uint8_t *)cases[i].uri,
+                                 cases[i].method, &path_found);
+        if (cases[i].idx < 0) {
+            TEST_ASSERT_NULL(res);
+            TEST_ASSERT(path_found == cases[i].path_found);
+        }
+        else {
+            TEST_ASSERT(res == &resources[cases[i].idx]);
+        }
+    }
+    /* empty array */
+    TEST_ASSERT_NULL(coap_find_resource(resources, 0, (const uint8_t *)"/a",
+                                        COAP_GET, NULL));
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -863,6 +929,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__add_path_unterminated_string),
         new_TestFixture(test_nanocoap__add_get_proxy_uri),
         new_TestFixture(test_nanocoap__token_length_over_limit),
+        new_TestFixture(test_nanocoap__find_resource),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -15,6 +15,7 @@
 
 #include "embUnit.h"
 
+#include "kernel_defines.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
 
@@ -139,6 +140,41 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_getnext__other_type(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entries[1]));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16)));
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8 + 1, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+}
+
+void test_netreg_lookup__many_contexts(void)
+{
+    /* more contexts than gnrc_netreg_hash has buckets */
+    static gnrc_netreg_entry_t many[64];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + i, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + i) == &many[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(&many[i]));
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + i));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + i) ==
+                    ((i % 2) ? &many[i] : NULL));
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -149,12 +185,14 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_unregister__success3),
         new_TestFixture(test_netreg_lookup__wrong_type_undef),
         new_TestFixture(test_netreg_lookup__wrong_type_numof),
+        new_TestFixture(test_netreg_lookup__many_contexts),
         new_TestFixture(test_netreg_num__empty),
         new_TestFixture(test_netreg_num__wrong_type_undef),
         new_TestFixture(test_netreg_num__wrong_type_numof),
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__other_type),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -25,6 +25,12 @@
 #include "unittests-constants.h"
 #include "tests-pktbuf.h"
 
+/* gnrc_pktbuf_malloc and gnrc_pktbuf_slab do not allocate from a single
+ * arena of CONFIG_GNRC_PKTBUF_SIZE bytes */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
+#define TEST_PKTBUF_ARENA
+#endif
+
 typedef struct __attribute__((packed)) {
     uint8_t u8;
     uint16_t u16;
@@ -202,6 +208,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_SLAB
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -225,6 +232,60 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#else
+static void test_pktbuf_add__success(void)
+{
+    gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE,
+                              GNRC_NETTYPE_TEST);
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NULL(pkt->next);
+        TEST_ASSERT_NOT_NULL(pkt->data);
+        TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE, pkt->size);
+        TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_TEST, pkt->type);
+        TEST_ASSERT_EQUAL_INT(1, pkt->users);
+
+        if (pkt_prev != NULL) {
+            TEST_ASSERT(pkt_prev < pkt);
+            TEST_ASSERT(pkt_prev->data < pkt->data);
+        }
+
+        pkt_prev = pkt;
+    }
+    /* all blocks of the largest size class are in use */
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add__spill(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* exhaust the frame class, the next frame is served by the MTU class */
+    for (unsigned i = 0; i <= CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF; i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, NULL,
+                                              CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE,
+                                              GNRC_NETTYPE_TEST);
+
+        TEST_ASSERT_NOT_NULL(tmp);
+        pkt = tmp;
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -245,7 +306,7 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+#ifdef TEST_PKTBUF_ARENA   /* alignment-handling left to malloc, so no certainty here */
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -653,7 +714,36 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static void test_pktbuf_realloc_data__shared_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+    void *exp_data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* the marked header shares the block with the rest of the data */
+    hdr = gnrc_pktbuf_mark(pkt, 4, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    exp_data = hdr->data;
+    /* so it must not grow in place */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 8));
+    TEST_ASSERT(exp_data != hdr->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, hdr->data, 4));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16 + 4, pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* the data left is the only user of the block now and grows in place */
+    exp_data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, sizeof(TEST_STRING16)));
+    TEST_ASSERT(exp_data == pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
+#ifdef TEST_PKTBUF_ARENA
 static void test_pktbuf_merge_data__memfull(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, (CONFIG_GNRC_PKTBUF_SIZE / 4),
@@ -665,7 +755,22 @@ static void test_pktbuf_merge_data__memfull(void)
     gnrc_pktbuf_release(pkt);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#elif defined(MODULE_GNRC_PKTBUF_SLAB)
+static void test_pktbuf_merge_data__memfull(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          (CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE / 2),
+                                          GNRC_NETTYPE_TEST);
+
+    pkt = gnrc_pktbuf_add(pkt, NULL, (CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE / 2) + 1,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* the merged data does not fit into a block of any size class */
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_merge(pkt));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_merge_data__success1(void)
 {
@@ -813,7 +918,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#ifdef TEST_PKTBUF_ARENA
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -835,7 +940,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif /* TEST_PKTBUF_ARENA */
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -867,8 +972,12 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
         new_TestFixture(test_pktbuf_add__success),
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_add__too_large),
+        new_TestFixture(test_pktbuf_add__spill),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#ifdef TEST_PKTBUF_ARENA
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -892,9 +1001,12 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success),
         new_TestFixture(test_pktbuf_realloc_data__success2),
         new_TestFixture(test_pktbuf_realloc_data__success3),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_realloc_data__shared_block),
+#endif
+#if defined(TEST_PKTBUF_ARENA) || defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_merge_data__memfull),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_merge_data__success1),
         new_TestFixture(test_pktbuf_merge_data__success2),
         new_TestFixture(test_pktbuf_hold__pkt_null),
@@ -906,9 +1018,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#ifdef TEST_PKTBUF_ARENA
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
     };
 
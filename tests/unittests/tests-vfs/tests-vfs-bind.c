@@ -35,13 +35,16 @@ static const uint8_t str_data[] = "This is a test file";
 
 static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes);
 static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static int _mock_fsync(vfs_file_t *filp);
 
 static volatile int _mock_write_calls = 0;
 static volatile int _mock_read_calls = 0;
+static volatile int _mock_fsync_calls = 0;
 
 static vfs_file_ops_t _test_bind_ops = {
     .read = _mock_read,
     .write = _mock_write,
+    .fsync = _mock_fsync,
 };
 
 static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
@@ -66,6 +69,13 @@ static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
     return nbytes;
 }
 
+static int _mock_fsync(vfs_file_t *filp)
+{
+    (void)filp;
+    ++_mock_fsync_calls;
+    return 0;
+}
+
 static void test_vfs_bind(void)
 {
     int fd;
@@ -94,8 +104,16 @@ static void test_vfs_bind(void)
     TEST_ASSERT_EQUAL_INT(_VFS_TEST_BIND_BUFSIZE, nbytes);
     TEST_ASSERT_EQUAL_INT(0, memcmp(&buf[0], &strbuf[0], nbytes));
 
-    int res = vfs_close(fd);
+    ncalls = _mock_fsync_calls;
+    int res = vfs_fsync(fd);
+    TEST_ASSERT_EQUAL_INT(_mock_fsync_calls, ncalls + 1);
     TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_fsync(fd);
+    TEST_ASSERT_EQUAL_INT(-EBADF, res);
 }
 
 static void test_vfs_bind__leak_fds(void)
@@ -150,6 +150,14 @@ static void test_vfs_null_file_ops_write(void)
     TEST_ASSERT_EQUAL_INT(-EFAULT, res);
 }
 
+static void test_vfs_null_file_ops_fsync(void)
+{
+    TEST_ASSERT(_test_vfs_file_op_my_fd >= 0);
+    /* nothing is buffered without a driver function */
+    int res = vfs_fsync(_test_vfs_file_op_my_fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 Test *tests_vfs_null_file_ops_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -159,6 +167,7 @@ Test *tests_vfs_null_file_ops_tests(void)
         new_TestFixture(test_vfs_null_file_ops_fstat),
         new_TestFixture(test_vfs_null_file_ops_read),
         new_TestFixture(test_vfs_null_file_ops_write),
+        new_TestFixture(test_vfs_null_file_ops_fsync),
     };
 
     EMB_UNIT_TESTCALLER(vfs_file_op_tests, setup, teardown, fixtures);
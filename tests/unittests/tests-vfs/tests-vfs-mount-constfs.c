@@ -15,6 +15,7 @@
  * @author      Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <sys/stat.h>
@@ -55,6 +56,19 @@ static const constfs_t fs_data = {
     .nfiles = ARRAY_SIZE(_files),
 };
 
+static const constfs_file_t _other_files[] = {
+    {
+        .path = "/other.txt",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t fs_other = {
+    .files = _other_files,
+    .nfiles = ARRAY_SIZE(_other_files),
+};
+
 static vfs_mount_t _test_vfs_mount_invalid_mount = {
     .mount_point = "test",
     .fs = &constfs_file_system,
@@ -67,6 +81,18 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_other,
+};
+
+static vfs_mount_t _test_vfs_mount_sibling = {
+    .mount_point = "/testing",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_other,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -171,6 +197,39 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void _assert_opens(const char *name, bool opens)
+{
+    int fd = vfs_open(name, O_RDONLY, 0);
+    if (fd >= 0) {
+        vfs_close(fd);
+    }
+    TEST_ASSERT_EQUAL_INT(opens ? 1 : 0, fd >= 0);
+}
+
+static void test_vfs_mount__nested(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount_nested));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount_sibling));
+
+    /* the longest mount point that is a prefix of the path wins */
+    _assert_opens("/test/test.txt", true);
+    _assert_opens("/test/sub/other.txt", true);
+    _assert_opens("/test/sub/test.txt", false);
+    _assert_opens("/testing/other.txt", true);
+    /* mount points only match at directory separators */
+    _assert_opens("/tests/other.txt", false);
+    _assert_opens("/test/subother.txt", false);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount_nested));
+    _assert_opens("/test/sub/other.txt", false);
+    _assert_opens("/testing/other.txt", true);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount_sibling));
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount));
+    _assert_opens("/test/test.txt", false);
+}
+
 #if MODULE_NEWLIB || defined(BOARD_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -207,6 +266,7 @@ Test *tests_vfs_mount_constfs_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_vfs_mount_umount),
         new_TestFixture(test_vfs_mount__invalid),
+        new_TestFixture(test_vfs_mount__nested),
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
@@ -32,6 +32,41 @@ static void cb_incr(void *arg)
     *ptr += 1;
 }
 
+/**
+ * @brief   Argument of the callbacks that operate on a timer of a clock
+ */
+typedef struct {
+    ztimer_clock_t *clock;      /**< clock of the timer */
+    ztimer_t *timer;            /**< timer to remove or to set again */
+    uint32_t *count;            /**< number of alarms */
+    uint32_t val;               /**< offset to set the timer again with */
+    uint32_t limit;             /**< number of alarms to stop setting at */
+} cb_ctx_t;
+
+/**
+ * @brief   Callback counting alarms and removing another timer
+ */
+static void cb_remove(void *arg)
+{
+    cb_ctx_t *ctx = arg;
+
+    *ctx->count += 1;
+    ztimer_remove(ctx->clock, ctx->timer);
+}
+
+/**
+ * @brief   Callback counting alarms and setting its own timer again
+ */
+static void cb_rearm(void *arg)
+{
+    cb_ctx_t *ctx = arg;
+
+    *ctx->count += 1;
+    if (*ctx->count < ctx->limit) {
+        ztimer_set(ctx->clock, ctx->timer, ctx->val);
+    }
+}
+
 /**
  * @brief   Testing 32 bit wide mock clock now functionality
  */
@@ -249,6 +284,158 @@ static void test_ztimer_mock_set16(void)
     TEST_ASSERT_EQUAL_INT(0x100207d2, now);
 }
 
+/**
+ * @brief   Testing timers that expire across the wrap-around of a 32 bit
+ *          wide mock clock
+ */
+static void test_ztimer_mock_set_wrap32(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_jump(&zmock, 0xfffffff0ul);
+
+    uint32_t count[4] = { 0 };
+    ztimer_t alarm[4] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+        { .callback = cb_incr, .arg = &count[2], },
+        { .callback = cb_incr, .arg = &count[3], },
+    };
+    ztimer_set(z, &alarm[0], 0x08);             /* before the wrap-around */
+    ztimer_set(z, &alarm[1], 0x10);             /* at the wrap-around */
+    ztimer_set(z, &alarm[2], 0x20);             /* after the wrap-around */
+    ztimer_set(z, &alarm[3], 0x80000000ul);     /* far after it */
+
+    ztimer_mock_advance(&zmock, 0x07);          /* now = 0xfffffff7 */
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    ztimer_mock_advance(&zmock, 0x01);          /* now = 0xfffffff8 */
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    ztimer_mock_advance(&zmock, 0x07);          /* now = 0xffffffff */
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    ztimer_mock_advance(&zmock, 0x01);          /* now = 0 */
+    TEST_ASSERT_EQUAL_INT(0, ztimer_now(z));
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    TEST_ASSERT_EQUAL_INT(0, count[2]);
+    ztimer_mock_advance(&zmock, 0x0f);          /* now = 0x0f */
+    TEST_ASSERT_EQUAL_INT(0, count[2]);
+    ztimer_mock_advance(&zmock, 0x01);          /* now = 0x10 */
+    TEST_ASSERT_EQUAL_INT(1, count[2]);
+    ztimer_mock_advance(&zmock, 0x7fffffdful);  /* now = 0x7fffffef */
+    TEST_ASSERT_EQUAL_INT(0, count[3]);
+    ztimer_mock_advance(&zmock, 0x01);          /* now = 0x7ffffff0 */
+    TEST_ASSERT_EQUAL_INT(0x7ffffff0ul, ztimer_now(z));
+    TEST_ASSERT_EQUAL_INT(1, count[3]);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    TEST_ASSERT_EQUAL_INT(1, count[2]);
+}
+
+/**
+ * @brief   Testing removal of timers that did not expire yet
+ */
+static void test_ztimer_mock_remove_pending(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count[4] = { 0 };
+    ztimer_t alarm[4] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+        { .callback = cb_incr, .arg = &count[2], },
+        { .callback = cb_incr, .arg = &count[3], },
+    };
+    /* two timers at the same time, one due much later and one in between */
+    ztimer_set(z, &alarm[0], 100);
+    ztimer_set(z, &alarm[1], 100);
+    ztimer_set(z, &alarm[2], 70000ul);
+    ztimer_set(z, &alarm[3], 5000);
+
+    ztimer_mock_advance(&zmock, 50);            /* now = 50 */
+    ztimer_remove(z, &alarm[0]);
+    ztimer_remove(z, &alarm[2]);
+    ztimer_mock_advance(&zmock, 50);            /* now = 100 */
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    /* the removed timers can be set again */
+    ztimer_set(z, &alarm[0], 10);
+    ztimer_set(z, &alarm[2], 10);
+    ztimer_remove(z, &alarm[0]);
+    ztimer_mock_advance(&zmock, 10);            /* now = 110 */
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[2]);
+    /* remove the next timer after its slot was reached */
+    ztimer_mock_advance(&zmock, 4889);          /* now = 4999 */
+    TEST_ASSERT_EQUAL_INT(0, count[3]);
+    ztimer_remove(z, &alarm[3]);
+    ztimer_mock_advance(&zmock, 100000ul);      /* now = 104999 */
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    TEST_ASSERT_EQUAL_INT(1, count[2]);
+    TEST_ASSERT_EQUAL_INT(0, count[3]);
+
+    /* two timers expiring at the same time remove each other */
+    uint32_t removed = 0;
+    ztimer_t removing[2];
+    cb_ctx_t ctx[2] = {
+        { .clock = z, .timer = &removing[1], .count = &removed, },
+        { .clock = z, .timer = &removing[0], .count = &removed, },
+    };
+    removing[0] = (ztimer_t){ .callback = cb_remove, .arg = &ctx[0], };
+    removing[1] = (ztimer_t){ .callback = cb_remove, .arg = &ctx[1], };
+    ztimer_set(z, &removing[0], 20);
+    ztimer_set(z, &removing[1], 20);
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(1, removed);
+}
+
+/**
+ * @brief   Testing timers that are set again from their callback
+ */
+static void test_ztimer_mock_set_from_callback(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count[2] = { 0 };
+    ztimer_t alarm[2];
+    cb_ctx_t ctx[2] = {
+        { .clock = z, .timer = &alarm[0], .count = &count[0],
+          .val = 100, .limit = 15, },
+        /* long enough to be placed in an upper level of a timing wheel */
+        { .clock = z, .timer = &alarm[1], .count = &count[1],
+          .val = 0x12345ul, .limit = UINT32_MAX, },
+    };
+    alarm[0] = (ztimer_t){ .callback = cb_rearm, .arg = &ctx[0], };
+    alarm[1] = (ztimer_t){ .callback = cb_rearm, .arg = &ctx[1], };
+    ztimer_set(z, &alarm[0], 100);
+    ztimer_set(z, &alarm[1], 0x12345ul);
+
+    ztimer_mock_advance(&zmock, 999);           /* now = 999 */
+    TEST_ASSERT_EQUAL_INT(9, count[0]);
+    ztimer_mock_advance(&zmock, 1);             /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(10, count[0]);
+    /* stops setting itself again at the limit */
+    ztimer_mock_advance(&zmock, 10000);         /* now = 11000 */
+    TEST_ASSERT_EQUAL_INT(15, count[0]);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    ztimer_mock_advance(&zmock, (3 * 0x12345ul) - 11001);
+    TEST_ASSERT_EQUAL_INT(2, count[1]);
+    ztimer_mock_advance(&zmock, 1);             /* now = 3 * 0x12345 */
+    TEST_ASSERT_EQUAL_INT(3, count[1]);
+    ztimer_remove(z, &alarm[1]);
+    ztimer_mock_advance(&zmock, 0x12345ul);
+    TEST_ASSERT_EQUAL_INT(3, count[1]);
+    TEST_ASSERT_EQUAL_INT(15, count[0]);
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -258,6 +445,9 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_now3),
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
+        new_TestFixture(test_ztimer_mock_set_wrap32),
+        new_TestFixture(test_ztimer_mock_remove_pending),
+        new_TestFixture(test_ztimer_mock_set_from_callback),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);